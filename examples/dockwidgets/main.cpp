@@ -51,6 +51,9 @@ int main(int argc, char **argv)
     QCommandLineOption lazyResizeOption("l", QCoreApplication::translate("main", "Use lazy resize"));
     parser.addOption(lazyResizeOption);
 
+    QCommandLineOption outlineDraggingOption("o", QCoreApplication::translate("main", "Drag an outline instead of the actual window"));
+    parser.addOption(outlineDraggingOption);
+
     QCommandLineOption multipleMainWindows("m", QCoreApplication::translate("main", "Shows two multiple main windows"));
     parser.addOption(multipleMainWindows);
 
@@ -129,6 +132,9 @@ int main(int argc, char **argv)
     if (parser.isSet(lazyResizeOption))
         flags |= KDDockWidgets::Config::Flag_LazyResize;
 
+    if (parser.isSet(outlineDraggingOption))
+        flags |= KDDockWidgets::Config::Flag_OutlineDragging;
+
     if (parser.isSet(tabsHaveCloseButton))
         flags |= KDDockWidgets::Config::Flag_TabsHaveCloseButton;
 
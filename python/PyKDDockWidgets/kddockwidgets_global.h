@@ -21,4 +21,5 @@
 #include <MainWindow.h>
 #include <DockWidgetBase.h>
 #include <DockWidget.h>
+#include <LayoutSaver.h>
 
@@ -21,6 +21,12 @@
 #include "multisplitter/Widget_qwidget.h"
 #include "DockRegistry_p.h"
 #include "FrameworkWidgetFactory.h"
+#include "FramePool_p.h"
+#include "FloatingWindowPool_p.h"
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+# include "multisplitter/Widget_quick.h"
+#endif
 
 #include <QApplication>
 #include <QDebug>
@@ -50,6 +56,11 @@ public:
     FrameworkWidgetFactory *m_frameworkWidgetFactory;
     Flags m_flags = Flag_Default;
     qreal m_draggedWindowOpacity = Q_QNAN;
+    int m_framePoolSize = 0;
+    int m_framePoolIdleTimeout = 30000;
+    int m_floatingWindowPoolSize = 0;
+    int m_dockWidgetHibernationTimeout = 0;
+    int m_lazyWindowResizeInterval = 100;
 };
 
 Config::Config()
@@ -93,6 +104,8 @@ void Config::setFlags(Flags f)
 
     auto multisplitterFlags = Layouting::Config::self().flags();
     multisplitterFlags.setFlag(Layouting::Config::Flag::LazyResize, d->m_flags & Flag_LazyResize);
+    multisplitterFlags.setFlag(Layouting::Config::Flag::CoalesceSizeConstraints, d->m_flags & Flag_CoalesceSizeConstraints);
+    multisplitterFlags.setFlag(Layouting::Config::Flag::BatchGeometryUpdates, d->m_flags & Flag_BatchGeometryUpdates);
     Layouting::Config::self().setFlags(multisplitterFlags);
 }
 
@@ -143,6 +156,16 @@ void Config::setSeparatorThickness(int value)
     Layouting::Config::self().setSeparatorThickness(value);
 }
 
+void Config::setSolvedGeometryCacheSize(int size)
+{
+    Layouting::Config::self().setSolvedGeometryCacheSize(size);
+}
+
+int Config::solvedGeometryCacheSize() const
+{
+    return Layouting::Config::self().solvedGeometryCacheSize();
+}
+
 void Config::setDraggedWindowOpacity(qreal opacity)
 {
     d->m_draggedWindowOpacity = opacity;
@@ -153,6 +176,66 @@ qreal Config::draggedWindowOpacity() const
     return d->m_draggedWindowOpacity;
 }
 
+void Config::setFramePoolSize(int size)
+{
+    d->m_framePoolSize = qMax(0, size);
+    if (FramePool::self()->count() > d->m_framePoolSize)
+        FramePool::self()->clear();
+}
+
+int Config::framePoolSize() const
+{
+    return d->m_framePoolSize;
+}
+
+void Config::setFramePoolIdleTimeout(int msecs)
+{
+    d->m_framePoolIdleTimeout = qMax(0, msecs);
+}
+
+int Config::framePoolIdleTimeout() const
+{
+    return d->m_framePoolIdleTimeout;
+}
+
+void Config::setFloatingWindowPoolSize(int size)
+{
+#ifdef KDDOCKWIDGETS_QTQUICK
+    if (size > 0)
+        qWarning() << Q_FUNC_INFO << "Floating window pooling isn't supported with QtQuick";
+    size = 0;
+#endif
+
+    d->m_floatingWindowPoolSize = qMax(0, size);
+    if (FloatingWindowPool::self()->count() > d->m_floatingWindowPoolSize)
+        FloatingWindowPool::self()->clear();
+}
+
+int Config::floatingWindowPoolSize() const
+{
+    return d->m_floatingWindowPoolSize;
+}
+
+void Config::setDockWidgetHibernationTimeout(int msecs)
+{
+    d->m_dockWidgetHibernationTimeout = qMax(0, msecs);
+}
+
+int Config::dockWidgetHibernationTimeout() const
+{
+    return d->m_dockWidgetHibernationTimeout;
+}
+
+void Config::setLazyWindowResizeInterval(int msecs)
+{
+    d->m_lazyWindowResizeInterval = qMax(0, msecs);
+}
+
+int Config::lazyWindowResizeInterval() const
+{
+    return d->m_lazyWindowResizeInterval;
+}
+
 void Config::setQmlEngine(QQmlEngine *qmlEngine)
 {
     if (d->m_qmlEngine) {
@@ -161,6 +244,21 @@ void Config::setQmlEngine(QQmlEngine *qmlEngine)
     }
 
     d->m_qmlEngine = qmlEngine;
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+    // Compile the components instantiated from C++ now, instead of when the first window is created
+    if (qmlEngine) {
+        const QStringList filenames = {
+            QStringLiteral("qrc:/kddockwidgets/private/quick/qml/DockWidget.qml"),
+            QStringLiteral("qrc:/kddockwidgets/private/quick/qml/Frame.qml"),
+            QStringLiteral("qrc:/kddockwidgets/private/quick/qml/FloatingWindow.qml"),
+            QStringLiteral(":/kddockwidgets/multisplitter/qml/Separator.qml")
+        };
+
+        for (const QString &filename : filenames)
+            Layouting::Widget_quick::component(qmlEngine, filename);
+    }
+#endif
 }
 
 QQmlEngine *Config::qmlEngine() const
@@ -194,6 +292,15 @@ void Config::Private::fixFlags()
 #if !defined(Q_OS_WIN) && !defined(Q_OS_MACOS)
     m_flags = m_flags & ~Flag_AeroSnapWithClientDecos;
 #endif
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+    // The drag outline is a QRubberBand, not implemented for QtQuick yet
+    m_flags = m_flags & ~Flag_OutlineDragging;
+#else
+    // QtQuick only. QWidget geometry changes are already batched by the paint cycle
+    m_flags = m_flags & ~Flag_BatchGeometryUpdates;
+    m_flags = m_flags & ~Flag_AsyncQmlIncubation;
+#endif
 }
 
 }
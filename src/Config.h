@@ -59,11 +59,16 @@ public:
         Flag_HideTitleBarWhenTabsVisible = 8, ///> Hides the title bar if there's tabs visible. The empty space in the tab bar becomes draggable.
         Flag_AlwaysShowTabs = 16, ///> Always show tabs, even if there's only one,
         Flag_AllowReorderTabs = 32, /// Allows user to re-order tabs by dragging them
-        Flag_LazyResize = 32, /// The dock widgets are resized in a lazy manner. The actual resize only happens when you release the mouse button.
         Flag_TabsHaveCloseButton = 64, /// Tabs will have a close button. Equivalent to QTabWidget::setTabsClosable(true).
         Flag_DoubleClickMaximizes = 128, /// Double clicking the titlebar will maximize a floating window instead of re-docking it
         Flag_TitleBarHasMaximizeButton = 256, /// The title bar will have a maximize/restore button when floating. This is mutually-exclusive with the floating button (since many apps behave that way).
         Flag_TitleBarIsFocusable = 512, /// You can click the title bar and it will focus the last focused widget in the focus scope. If no previously focused widget then it focuses the user's dock widget guest, which should accept focus or use a focus proxy.
+        Flag_OutlineDragging = 1024, /// While dragging, the floating window stays put and only a translucent outline follows the mouse. The window is moved when the mouse is released. Detached tabs only get a native window if they aren't dropped. QtWidgets only.
+        Flag_CoalesceSizeConstraints = 2048, /// Changes to the dock widgets' min/max sizes are applied once per event loop iteration, instead of relayouting for each change.
+        Flag_LazyWindowResize = 4096, /// While a main window or floating window is being resized its dock widgets are only relayouted every Config::lazyWindowResizeInterval() milliseconds, instead of for every intermediate size.
+        Flag_BatchGeometryUpdates = 8192, /// The geometry changes of a relayout are accumulated and applied to the QML items once per frame, before the scene graph is synchronized, so bindings are evaluated once per changed item. QtQuick only.
+        Flag_AsyncQmlIncubation = 16384, /// The QML of frames and of dock widget contents set with DockWidgetQuick::setWidget(const QString &) is incubated asynchronously over the next frames, so windows appear before their contents are created. See DockWidgetQuick::contentReady(). QtQuick only.
+        Flag_LazyResize = 32768, /// The dock widgets are resized in a lazy manner. The actual resize only happens when you release the mouse button. Floating windows show an outline while being resized.
         Flag_Default = Flag_AeroSnapWithClientDecos ///> The defaults
     };
     Q_DECLARE_FLAGS(Flags, Flag)
@@ -89,6 +94,9 @@ public:
      * If a DockWidget doesn't exist then a DockWidgetFactoryFunc function is
      * required, so the layout saver can ask to create the DockWidget and then
      * restore it.
+     *
+     * For expensive dock widgets, the factory can call DockWidgetBase::setWidgetFactory()
+     * instead of DockWidgetBase::setWidget(), so the guest widget is only created once shown.
      */
     void setDockWidgetFactoryFunc(DockWidgetFactoryFunc);
 
@@ -139,7 +147,78 @@ public:
     ///By default it's 1.0, fully opaque
     qreal draggedWindowOpacity() const;
 
+    /**
+     * @brief Sets how many empty frames are kept around to be reused, instead of being deleted.
+     *
+     * Docking, undocking, tabbing and restoring layouts constantly create and destroy frames.
+     * Reusing them saves constructing their title bar and tab widget, style polish and layouting.
+     * Only honoured by DefaultWidgetFactory::createFrame().
+     *
+     * Default is 0, which disables pooling.
+     */
+    void setFramePoolSize(int size);
+
+    ///@brief returns the maximum number of pooled frames
+    ///@sa setFramePoolSize()
+    int framePoolSize() const;
+
+    ///@brief Sets after how many milliseconds without reusing or recycling any frame the pool is emptied.
+    ///0 means never, pooled frames then live until the application quits. Default is 30000.
+    ///Also applies to the floating window pool, see setFloatingWindowPoolSize().
+    void setFramePoolIdleTimeout(int msecs);
+
+    ///@brief returns the idle timeout in milliseconds
+    ///@sa setFramePoolIdleTimeout()
+    int framePoolIdleTimeout() const;
+
+    /**
+     * @brief Sets how many hidden floating windows are kept around to be reused, instead of being deleted.
+     *
+     * A hidden floating window keeps its native window, so floating a dock widget or detaching a tab
+     * doesn't need to create a new platform window each time.
+     * Only honoured by DefaultWidgetFactory::createFloatingWindow(). QtWidgets only.
+     *
+     * Default is 0, which disables pooling.
+     */
+    void setFloatingWindowPoolSize(int size);
+
+    ///@brief returns the maximum number of pooled floating windows
+    ///@sa setFloatingWindowPoolSize()
+    int floatingWindowPoolSize() const;
+
+    /**
+     * @brief Sets after how many milliseconds a closed dock widget releases its guest widget.
+     *
+     * Only applies to dock widgets using DockWidgetBase::setWidgetFactory(), as the guest needs to
+     * be recreated when the dock widget is shown again. See DockWidgetBase::hibernate().
+     *
+     * Default is 0, which disables hibernation.
+     */
+    void setDockWidgetHibernationTimeout(int msecs);
+
+    ///@brief returns the hibernation timeout in milliseconds
+    ///@sa setDockWidgetHibernationTimeout()
+    int dockWidgetHibernationTimeout() const;
+
+    ///@brief Sets how often, in milliseconds, the layout follows the window size while resizing.
+    ///Only used with Flag_LazyWindowResize. Default is 100.
+    void setLazyWindowResizeInterval(int msecs);
+
+    ///@brief returns the lazy window resize interval in milliseconds
+    ///@sa setLazyWindowResizeInterval()
+    int lazyWindowResizeInterval() const;
+
+    ///@brief Sets how many solved layouts to remember, so resizing a window back to a size it
+    ///already had, with the same layout, reuses the previous geometries. Default is 0 (disabled).
+    ///Least recently used layouts are discarded first.
+    void setSolvedGeometryCacheSize(int size);
+
+    ///@brief returns the solved geometry cache size
+    ///@sa setSolvedGeometryCacheSize()
+    int solvedGeometryCacheSize() const;
+
     ///@brief Sets the QQmlEngine to use. Applicable only when using QtQuick.
+    ///The QML components of frames, dock widgets, floating windows and separators are compiled here.
     void setQmlEngine(QQmlEngine *);
     QQmlEngine* qmlEngine() const;
 
@@ -65,6 +65,12 @@ public:
 
         toggleAction->setCheckable(true);
         floatAction->setCheckable(true);
+
+        hibernationTimer.setSingleShot(true);
+        q->connect(&hibernationTimer, &QTimer::timeout, q, [this] {
+            if (!q->isOpen())
+                q->hibernate();
+        });
     }
 
     void init()
@@ -103,6 +109,8 @@ public:
     QIcon titleBarIcon;
     QIcon tabBarIcon;
     QWidgetOrQuick *widget = nullptr;
+    DockWidgetBase::WidgetFactoryFunc widgetFactory = nullptr;
+    DockWidgetBase::WidgetReleaseFunc widgetReleaseFunc = nullptr;
     DockWidgetBase *const q;
     DockWidgetBase::Options options;
     QAction *const toggleAction;
@@ -111,6 +119,9 @@ public:
     bool m_updatingToggleAction = false;
     bool m_updatingFloatAction = false;
     bool m_isForceClosing = false;
+    bool m_creatingWidget = false;
+    int m_hibernatedQObjectCount = 0;
+    QTimer hibernationTimer;
 };
 
 DockWidgetBase::DockWidgetBase(const QString &name, Options options)
@@ -215,6 +226,11 @@ void DockWidgetBase::setWidget(QWidgetOrQuick *w)
     Q_ASSERT(w && !d->widget);
     qCDebug(addwidget) << Q_FUNC_INFO << w;
 
+    if (!d->m_creatingWidget) {
+        d->widgetFactory = nullptr;
+        d->widgetReleaseFunc = nullptr;
+    }
+
     d->widget = w;
     setSizePolicy(w->sizePolicy());
 
@@ -227,6 +243,73 @@ QWidgetOrQuick *DockWidgetBase::widget() const
     return d->widget;
 }
 
+void DockWidgetBase::setWidgetFactory(WidgetFactoryFunc func, WidgetReleaseFunc releaseFunc)
+{
+    if (d->widget) {
+        qWarning() << Q_FUNC_INFO << "Dock widget already has a widget" << this;
+        return;
+    }
+
+    d->widgetFactory = func;
+    d->widgetReleaseFunc = releaseFunc;
+
+    // Already visible, no point in deferring
+    if (isVisible())
+        ensureWidget();
+}
+
+bool DockWidgetBase::hasPendingWidget() const
+{
+    return !d->widget && d->widgetFactory;
+}
+
+void DockWidgetBase::ensureWidget()
+{
+    if (!hasPendingWidget() || d->m_creatingWidget) // Guard against the factory showing us
+        return;
+
+    qCDebug(addwidget) << Q_FUNC_INFO << "Creating pending widget for" << this;
+    QScopedValueRollback<bool> guard(d->m_creatingWidget, true);
+    if (QWidgetOrQuick *w = d->widgetFactory(this)) {
+        d->m_hibernatedQObjectCount = 0;
+        setWidget(w);
+        w->setVisible(true);
+    } else {
+        qWarning() << Q_FUNC_INFO << "Widget factory returned nullptr for" << uniqueName();
+    }
+}
+
+bool DockWidgetBase::hibernate()
+{
+    if (!d->widget || !d->widgetFactory || isOpen())
+        return false;
+
+    d->hibernationTimer.stop();
+    QWidgetOrQuick *guest = d->widget;
+    d->widget = nullptr;
+    d->m_hibernatedQObjectCount = 1 + guest->findChildren<QObject*>().size();
+    qCDebug(hiding) << Q_FUNC_INFO << this << "; releasing" << d->m_hibernatedQObjectCount << "QObjects";
+
+    // While the guest still exists, so connected code can disconnect from it
+    Q_EMIT widgetChanged(nullptr);
+
+    if (d->widgetReleaseFunc)
+        d->widgetReleaseFunc(this, guest);
+
+    delete guest;
+    return true;
+}
+
+bool DockWidgetBase::isHibernated() const
+{
+    return d->m_hibernatedQObjectCount > 0;
+}
+
+int DockWidgetBase::hibernatedQObjectCount() const
+{
+    return d->m_hibernatedQObjectCount;
+}
+
 bool DockWidgetBase::isFloating() const
 {
     if (isWindow())
@@ -606,6 +689,10 @@ void DockWidgetBase::Private::close()
     qCDebug(hiding) << "DockWidget::close" << this;
     saveTabIndex();
 
+    const int hibernationTimeout = Config::self().dockWidgetHibernationTimeout();
+    if (hibernationTimeout > 0 && widget && widgetFactory)
+        hibernationTimer.start(hibernationTimeout);
+
     // Do some cleaning. Widget is hidden, but we must hide the tab containing it.
     if (Frame *frame = q->frame()) {
         frame->removeWidget(q);
@@ -687,6 +774,10 @@ void DockWidgetBase::onParentChanged()
 
 void DockWidgetBase::onShown(bool spontaneous)
 {
+    // Dock widgets in background tabs don't get shown, so this is when lazy content is created
+    d->hibernationTimer.stop();
+    ensureWidget();
+
     d->onDockWidgetShown();
     Q_EMIT shown();
 
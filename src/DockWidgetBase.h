@@ -64,6 +64,12 @@ class DOCKS_EXPORT DockWidgetBase : public QWidget
 public:
     typedef QVector<DockWidgetBase *> List;
 
+    ///@brief Function that creates the guest widget on demand. @sa setWidgetFactory()
+    typedef QWidgetOrQuick *(*WidgetFactoryFunc)(DockWidgetBase *dockWidget);
+
+    ///@brief Function called before a guest widget is deleted by hibernation. @sa hibernate()
+    typedef void (*WidgetReleaseFunc)(DockWidgetBase *dockWidget, QWidgetOrQuick *widget);
+
     ///@brief DockWidget options to pass at construction time
     enum Option {
         Option_None = 0, ///< No option, the default
@@ -136,9 +142,52 @@ public:
 
     /**
      * @brief returns the widget which this dock widget hosts
+     *
+     * Returns nullptr while the widget is still pending creation by a widget factory.
+     * @sa setWidgetFactory()
      */
     QWidgetOrQuick *widget() const;
 
+    /**
+     * @brief Sets a function which creates this dock widget's guest widget lazily.
+     *
+     * Use this instead of setWidget() for expensive widgets. The factory is only called, once,
+     * when the dock widget is first shown, so dock widgets sitting in a background tab stay empty
+     * and cheap until their tab becomes current. Useful in Config::dockWidgetFactoryFunc() when
+     * restoring layouts with many dock widgets.
+     *
+     * Calling setWidget() discards the factory.
+     *
+     * Having a factory also allows the dock widget to hibernate while closed. @p releaseFunc,
+     * which is optional, is then called right before the guest is deleted, so its state can be saved.
+     * @sa ensureWidget(), hasPendingWidget(), hibernate()
+     */
+    void setWidgetFactory(WidgetFactoryFunc func, WidgetReleaseFunc releaseFunc = nullptr);
+
+    ///@brief Returns whether a widget factory was set and hasn't created the widget yet
+    bool hasPendingWidget() const;
+
+    /**
+     * @brief Creates the guest widget now, if a widget factory is still pending.
+     * Does nothing otherwise.
+     */
+    void ensureWidget();
+
+    /**
+     * @brief Deletes the guest widget of a closed dock widget, to save memory.
+     *
+     * The dock widget itself and its previous position are kept. The guest is recreated by the
+     * widget factory when the dock widget is shown again. This is done automatically after
+     * Config::dockWidgetHibernationTimeout() if set.
+     *
+     * @return false if the dock widget is open or doesn't have a widget factory.
+     * @sa setWidgetFactory(), isHibernated()
+     */
+    bool hibernate();
+
+    ///@brief Returns whether the guest widget was released by hibernate() and not recreated yet
+    bool isHibernated() const;
+
     /**
      * @brief Returns whether the dock widget is floating.
      * Floating means it's not docked and has a window of its own.
@@ -337,7 +386,7 @@ Q_SIGNALS:
     ///@brief signal emitted when the title changed
     void titleChanged();
 
-    ///@brief emitted when the hosted widget changed
+    ///@brief emitted when the hosted widget changed. With nullptr when hibernate() releases it
     void widgetChanged(KDDockWidgets::QWidgetOrQuick *);
 
     ///@brief emitted when the options change
@@ -416,6 +465,10 @@ private:
     ///@brief Updates the floatAction state
     void updateFloatAction();
 
+    ///@brief Returns how many QObjects were released by hibernate(). 0 if not hibernated.
+    ///Only a proxy for the memory saved, as the size of each QObject varies a lot.
+    int hibernatedQObjectCount() const;
+
     class Private;
     Private *const d;
 };
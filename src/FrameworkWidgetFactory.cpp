@@ -15,6 +15,9 @@
 #include "multisplitter/Separator_p.h"
 #include "FloatingWindow_p.h"
 #include "Config.h"
+#include "FramePool_p.h"
+#include "FloatingWindowPool_p.h"
+#include "multisplitter/Tracing_p.h"
 #include "indicators/ClassicIndicators_p.h"
 
 #ifdef KDDOCKWIDGETS_QTWIDGETS
@@ -47,6 +50,10 @@ FrameworkWidgetFactory::~FrameworkWidgetFactory()
 #ifdef KDDOCKWIDGETS_QTWIDGETS
 Frame *DefaultWidgetFactory::createFrame(QWidgetOrQuick *parent, FrameOptions options) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFrame");
+    if (Frame *frame = FramePool::self()->take(parent, options))
+        return frame;
+
     return new FrameWidget(parent, options);
 }
 
@@ -77,11 +84,19 @@ Layouting::Separator *DefaultWidgetFactory::createSeparator(Layouting::Widget *p
 
 FloatingWindow *DefaultWidgetFactory::createFloatingWindow(MainWindowBase *parent) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFloatingWindow");
+    if (FloatingWindow *floatingWindow = FloatingWindowPool::self()->take(nullptr, parent))
+        return floatingWindow;
+
     return new FloatingWindowWidget(parent);
 }
 
 FloatingWindow *DefaultWidgetFactory::createFloatingWindow(Frame *frame, MainWindowBase *parent) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFloatingWindow");
+    if (FloatingWindow *floatingWindow = FloatingWindowPool::self()->take(frame, parent))
+        return floatingWindow;
+
     return new FloatingWindowWidget(frame, parent);
 }
 
@@ -106,6 +121,10 @@ QWidgetOrQuick *DefaultWidgetFactory::createRubberBand(QWidgetOrQuick *parent) c
 
 Frame *DefaultWidgetFactory::createFrame(QWidgetOrQuick *parent, FrameOptions options) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFrame");
+    if (Frame *frame = FramePool::self()->take(parent, options))
+        return frame;
+
     return new FrameQuick(parent, options);
 }
 
@@ -126,11 +145,13 @@ TitleBar *DefaultWidgetFactory::createTitleBar(FloatingWindow *fw) const
 
 FloatingWindow *DefaultWidgetFactory::createFloatingWindow(MainWindowBase *parent) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFloatingWindow");
     return new FloatingWindowQuick(parent);
 }
 
 FloatingWindow *DefaultWidgetFactory::createFloatingWindow(Frame *frame, MainWindowBase *parent) const
 {
+    KDDW_TRACE_SCOPE("creation", "DefaultWidgetFactory::createFloatingWindow");
     return new FloatingWindowQuick(frame, parent);
 }
 
@@ -70,6 +70,8 @@ public:
     ///       DockWidgets.
     ///@param parent just forward to Frame's constructor
     ///@param options just forward to Frame's constructor
+    ///@sa Config::setFramePoolSize(), DefaultWidgetFactory reuses pooled frames, sub-classes
+    ///    overriding this method without calling the base implementation won't.
     virtual Frame* createFrame(QWidgetOrQuick *parent = nullptr, FrameOptions options = FrameOption_None) const = 0;
 
     ///@brief Called internally by the framework to create a TitleBar
@@ -28,12 +28,18 @@
 #include "multisplitter/Item_p.h"
 #include "FrameworkWidgetFactory.h"
 #include "MainWindowBase.h"
+#include "multisplitter/Tracing_p.h"
 
 #include <qmath.h>
 #include <QDebug>
 #include <QSettings>
 #include <QApplication>
 #include <QFile>
+#include <QThread>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QJsonDocument>
 
 #include <memory>
 
@@ -42,6 +48,46 @@ using namespace KDDockWidgets;
 QHash<QString, LayoutSaver::DockWidget::Ptr> LayoutSaver::DockWidget::s_dockWidgets;
 LayoutSaver::Layout* LayoutSaver::Layout::s_currentLayoutBeingRestored = nullptr;
 
+// While set, LayoutSaver::DockWidget::dockWidgetForName() uses this table instead of s_dockWidgets,
+// so LayoutSaver::validateLayout() doesn't share any state with the GUI thread's saves and restores
+static thread_local QHash<QString, LayoutSaver::DockWidget::Ptr> *s_privateDockWidgets = nullptr;
+
+namespace {
+struct PrivateDockWidgetTable
+{
+    PrivateDockWidgetTable()
+    {
+        s_privateDockWidgets = &m_dockWidgets;
+    }
+
+    ~PrivateDockWidgetTable()
+    {
+        s_privateDockWidgets = nullptr;
+    }
+
+    QHash<QString, LayoutSaver::DockWidget::Ptr> m_dockWidgets;
+    Q_DISABLE_COPY(PrivateDockWidgetTable)
+};
+}
+
+/// Returns whether every item in the serialized splitter tree refers to a saved frame
+static bool guestIdsExist(const QVariantMap &item, const QHash<QString, LayoutSaver::Frame> &frames)
+{
+    const QString guestId = item.value(QStringLiteral("guestId")).toString();
+    if (!guestId.isEmpty() && !frames.contains(guestId)) {
+        qWarning() << Q_FUNC_INFO << "Item refers to unknown frame" << guestId;
+        return false;
+    }
+
+    const QVariantList childrenV = item.value(QStringLiteral("children")).toList();
+    for (const QVariant &childV : childrenV) {
+        if (!guestIdsExist(childV.toMap(), frames))
+            return false;
+    }
+
+    return true;
+}
+
 class KDDockWidgets::LayoutSaver::Private
 {
 public:
@@ -75,16 +121,80 @@ public:
     void deleteEmptyFrames();
     void clearRestoredProperty();
 
+    ///@brief Validates the parsed layout and clears what it's going to restore
+    bool prepareRestore(LayoutSaver::Layout &layout);
+
+    ///@brief The restore is split in steps, so it can also be done incrementally. See restoreLayoutAsync()
+    static int restoreStepCount(const LayoutSaver::Layout &layout);
+    bool restoreStep(const LayoutSaver::Layout &layout, int step);
+
+    ///@brief Shows or hides the top-levels whose visibility was deferred until the restore finished
+    ///and repaints the main windows frozen by prepareRestore()
+    void applyDeferredVisibility();
+
+    ///@brief Resizes the layouts whose window was resized while the restore ignored resizes
+    void syncLayoutSizes();
+
     std::unique_ptr<QSettings> settings() const;
     DockRegistry *const m_dockRegistry;
     const RestoreOptions m_restoreOptions;
     QStringList m_affinityNames;
 
+    // When restoring incrementally top-levels are kept hidden until the layout is consistent
+    bool m_deferVisibility = false;
+    QVector<QPair<QPointer<QWidgetOrQuick>, bool>> m_deferredVisibility;
+    QVector<QPointer<QWidgetOrQuick>> m_frozenWindows;
+
     static bool s_restoreInProgress;
 };
 
 bool LayoutSaver::Private::s_restoreInProgress = false;
 
+namespace {
+///@brief Parses the JSON in a worker thread, as it doesn't touch any widget
+class JsonParserThread : public QThread
+{
+public:
+    JsonParserThread(const QByteArray &data, QObject *parent)
+        : QThread(parent)
+        , m_data(data)
+    {
+    }
+
+    void run() override
+    {
+        QJsonParseError error;
+        const QJsonDocument doc = QJsonDocument::fromJson(m_data, &error);
+        m_success = error.error == QJsonParseError::NoError;
+        if (m_success)
+            m_map = doc.toVariant().toMap();
+    }
+
+    const QByteArray m_data;
+    QVariantMap m_map;
+    bool m_success = false;
+};
+}
+
+class KDDockWidgets::LayoutRestoreJob::Private
+{
+public:
+    Private(RestoreOptions options, int timeSliceMs)
+        : saver(options)
+        , timeSliceMs(timeSliceMs)
+    {
+    }
+
+    LayoutSaver saver;
+    LayoutSaver::Layout layout;
+    QPointer<JsonParserThread> parser;
+    QTimer timer;
+    const int timeSliceMs;
+    int stepsDone = 0;
+    int stepsTotal = 0;
+    bool finished = false;
+};
+
 
 static QVariantList stringListToVariant(const QStringList &strs)
 {
@@ -146,6 +256,7 @@ bool LayoutSaver::restoreFromFile(const QString &jsonFilename)
 
 QByteArray LayoutSaver::serializeLayout() const
 {
+    KDDW_TRACE_SCOPE("restore", "LayoutSaver::serializeLayout");
     if (!d->m_dockRegistry->isSane()) {
         qWarning() << Q_FUNC_INFO << "Refusing to serialize this layout. Check previous warnings.";
         return {};
@@ -156,6 +267,10 @@ QByteArray LayoutSaver::serializeLayout() const
     // Just a simplification. One less type of windows to handle.
     d->m_dockRegistry->ensureAllFloatingWidgetsAreMorphed();
 
+    // Save the geometries the user sees, not the ones from before a deferred window resize
+    for (MultiSplitter *layout : d->m_dockRegistry->layouts())
+        layout->applyPendingResize();
+
     const MainWindowBase::List mainWindows = d->m_dockRegistry->mainwindows();
     layout.mainWindows.reserve(mainWindows.size());
     for (MainWindowBase *mainWindow : mainWindows) {
@@ -196,6 +311,7 @@ QByteArray LayoutSaver::serializeLayout() const
 
 bool LayoutSaver::restoreLayout(const QByteArray &data)
 {
+    KDDW_TRACE_SCOPE("restore", "LayoutSaver::restoreLayout");
     d->clearRestoredProperty();
     if (data.isEmpty())
         return true;
@@ -223,22 +339,159 @@ bool LayoutSaver::restoreLayout(const QByteArray &data)
         return false;
     }
 
+    if (!d->prepareRestore(layout))
+        return false;
+
+    for (int i = 0, count = Private::restoreStepCount(layout); i < count; ++i) {
+        if (!d->restoreStep(layout, i))
+            return false;
+    }
+
+    return true;
+}
+
+bool LayoutSaver::validateLayout(const QByteArray &data)
+{
+    KDDW_TRACE_SCOPE("restore", "LayoutSaver::validateLayout");
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(data, &error);
+    if (error.error != QJsonParseError::NoError) {
+        qWarning() << Q_FUNC_INFO << "Failed to parse json data:" << error.errorString()
+                   << "at offset" << error.offset;
+        return false;
+    }
+
+    QVector<QVariantMap> splitterLayouts;
+    {
+        PrivateDockWidgetTable dockWidgets;
+        LayoutSaver::Layout layout(/*isBeingRestored=*/ false);
+        layout.fromVariantMap(doc.toVariant().toMap());
+        if (!layout.isValid())
+            return false;
+
+        QVector<const LayoutSaver::MultiSplitter *> multiSplitters;
+        for (const LayoutSaver::MainWindow &mw : qAsConst(layout.mainWindows))
+            multiSplitters.push_back(&mw.multiSplitterLayout);
+        for (const LayoutSaver::FloatingWindow &fw : qAsConst(layout.floatingWindows))
+            multiSplitters.push_back(&fw.multiSplitterLayout);
+
+        for (const LayoutSaver::MultiSplitter *multiSplitter : qAsConst(multiSplitters)) {
+            for (const LayoutSaver::Frame &frame : multiSplitter->frames) {
+                if (!frame.isValid())
+                    return false;
+            }
+
+            if (!guestIdsExist(multiSplitter->layout, multiSplitter->frames))
+                return false;
+
+            splitterLayouts.push_back(multiSplitter->layout);
+        }
+    }
+
+    // Replay each splitter tree on a dummy container, which has no host widget and creates no widgets
+    for (const QVariantMap &splitterLayout : qAsConst(splitterLayouts)) {
+        Layouting::ItemContainer root(nullptr);
+        root.fillFromVariantMap(splitterLayout, {});
+        if (!root.checkGeometries_recursive())
+            return false;
+    }
+
+    return true;
+}
+
+LayoutRestoreJob *LayoutSaver::restoreLayoutAsync(const QByteArray &data, int timeSliceMs)
+{
+    auto job = new LayoutRestoreJob(d->m_restoreOptions, timeSliceMs);
+    job->d->saver.d->m_affinityNames = d->m_affinityNames;
+    job->start(data);
+    return job;
+}
+
+void LayoutSaver::setAffinityNames(const QStringList &affinityNames)
+{
+    d->m_affinityNames = affinityNames;
+    if (affinityNames.contains(QString())) {
+        // Any window with empty affinity will also be subject to save/restore
+        d->m_affinityNames << QString();
+    }
+}
+
+DockWidgetBase::List LayoutSaver::restoredDockWidgets() const
+{
+    const DockWidgetBase::List &allDockWidgets = DockRegistry::self()->dockwidgets();
+    DockWidgetBase::List result;
+    result.reserve(allDockWidgets.size());
+    for (DockWidgetBase *dw : allDockWidgets) {
+        if (dw->property("kddockwidget_was_restored").toBool())
+            result.push_back(dw);
+    }
+
+    return result;
+}
+
+void LayoutSaver::Private::clearRestoredProperty()
+{
+    const DockWidgetBase::List &allDockWidgets = DockRegistry::self()->dockwidgets();
+    for (DockWidgetBase *dw : allDockWidgets) {
+        dw->setProperty("kddockwidget_was_restored", QVariant());
+    }
+}
+
+template <typename T>
+void LayoutSaver::Private::deserializeWindowGeometry(const T &saved, QWidgetOrQuick *topLevel)
+{
+    topLevel->setGeometry(saved.geometry);
+    if (m_deferVisibility)
+        m_deferredVisibility.push_back({ topLevel, saved.isVisible });
+    else
+        topLevel->setVisible(saved.isVisible);
+}
+
+bool LayoutSaver::Private::prepareRestore(LayoutSaver::Layout &layout)
+{
+    KDDW_TRACE_SCOPE("restore", "LayoutSaver::prepareRestore");
     if (!layout.isValid()) {
         return false;
     }
 
-    if (d->m_restoreOptions & RestoreOption_RelativeToMainWindow)
+    if (m_restoreOptions & RestoreOption_RelativeToMainWindow)
         layout.scaleSizes();
 
+    const MainWindowBase::List mainWindows = m_dockRegistry->mainWindows(layout.mainWindowNames());
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+    if (m_deferVisibility) {
+        // Already visible main windows can't be hidden, but don't let them paint half restored states
+        for (MainWindowBase *mainWindow : mainWindows) {
+            QWidget *window = mainWindow->window();
+            if (window->isVisible() && window->updatesEnabled()) {
+                window->setUpdatesEnabled(false);
+                m_frozenWindows.push_back(window);
+            }
+        }
+    }
+#endif
+
     // Hide all dockwidgets and unparent them from any layout before starting restore
     // We only close the stuff that the loaded JSON knows about. Unknown widgets might be newer.
-    d->m_dockRegistry->clear(d->m_dockRegistry->dockWidgets(layout.dockWidgetNames()),
-                             d->m_dockRegistry->mainWindows(layout.mainWindowNames()),
-                             d->m_affinityNames);
+    m_dockRegistry->clear(m_dockRegistry->dockWidgets(layout.dockWidgetNames()),
+                          mainWindows, m_affinityNames);
+
+    return true;
+}
+
+int LayoutSaver::Private::restoreStepCount(const LayoutSaver::Layout &layout)
+{
+    return layout.mainWindows.size() + layout.floatingWindows.size()
+            + layout.closedDockWidgets.size() + layout.allDockWidgets.size();
+}
 
+bool LayoutSaver::Private::restoreStep(const LayoutSaver::Layout &layout, int step)
+{
     // 1. Restore main windows
-    for (const LayoutSaver::MainWindow &mw : qAsConst(layout.mainWindows)) {
-        MainWindowBase *mainWindow = d->m_dockRegistry->mainWindowByName(mw.uniqueName);
+    if (step < layout.mainWindows.size()) {
+        KDDW_TRACE_SCOPE("restore", "restoreMainWindow");
+        const LayoutSaver::MainWindow &mw = layout.mainWindows.at(step);
+        MainWindowBase *mainWindow = m_dockRegistry->mainWindowByName(mw.uniqueName);
         if (!mainWindow ) {
             if (auto mwFunc = Config::self().mainWindowFactoryFunc()) {
                 mainWindow = mwFunc(mw.uniqueName);
@@ -248,91 +501,108 @@ bool LayoutSaver::restoreLayout(const QByteArray &data)
             }
         }
 
-        if (!d->matchesAffinity(mainWindow->affinities()))
-            continue;
+        if (!matchesAffinity(mainWindow->affinities()))
+            return true;
 
-        if (!(d->m_restoreOptions & RestoreOption_RelativeToMainWindow))
-            d->deserializeWindowGeometry(mw, mainWindow->window()); // window(), as the MainWindow can be embedded
+        if (!(m_restoreOptions & RestoreOption_RelativeToMainWindow))
+            deserializeWindowGeometry(mw, mainWindow->window()); // window(), as the MainWindow can be embedded
 
-        if (!mainWindow->deserialize(mw))
-            return false;
+        return mainWindow->deserialize(mw);
     }
+    step -= layout.mainWindows.size();
 
     // 2. Restore FloatingWindows
-    for (const LayoutSaver::FloatingWindow &fw : qAsConst(layout.floatingWindows)) {
-        if (!d->matchesAffinity(fw.affinities))
-            continue;
+    if (step < layout.floatingWindows.size()) {
+        KDDW_TRACE_SCOPE("restore", "restoreFloatingWindow");
+        const LayoutSaver::FloatingWindow &fw = layout.floatingWindows.at(step);
+        if (!matchesAffinity(fw.affinities))
+            return true;
 
         MainWindowBase *parent = fw.parentIndex == -1 ? nullptr
                                                       : DockRegistry::self()->mainwindows().at(fw.parentIndex);
 
         auto floatingWindow = Config::self().frameworkWidgetFactory()->createFloatingWindow(parent);
-        d->deserializeWindowGeometry(fw, floatingWindow);
-        if (!floatingWindow->deserialize(fw)) {
+        deserializeWindowGeometry(fw, floatingWindow);
+
+        bool ok;
+        if (m_deferVisibility) {
+            // Restore it hidden, deserializeWindowGeometry() already queued the saved visibility
+            LayoutSaver::FloatingWindow hiddenFw = fw;
+            hiddenFw.isVisible = false;
+            ok = floatingWindow->deserialize(hiddenFw);
+        } else {
+            ok = floatingWindow->deserialize(fw);
+        }
+
+        if (!ok) {
             qWarning() << Q_FUNC_INFO << "Failed to deserialize floating window";
             return false;
         }
+
+        return true;
     }
+    step -= layout.floatingWindows.size();
 
     // 3. Restore closed dock widgets. They remain closed but acquire geometry and placeholder properties
-    for (const auto &dw : qAsConst(layout.closedDockWidgets)) {
-        if (d->matchesAffinity(dw->affinities)) {
+    if (step < layout.closedDockWidgets.size()) {
+        KDDW_TRACE_SCOPE("restore", "restoreClosedDockWidget");
+        const auto &dw = layout.closedDockWidgets.at(step);
+        if (matchesAffinity(dw->affinities)) {
             DockWidgetBase::deserialize(dw);
         }
+
+        return true;
     }
+    step -= layout.closedDockWidgets.size();
 
     // 4. Restore the placeholder info, now that the Items have been created
-    for (const auto &dw : qAsConst(layout.allDockWidgets)) {
-        if (!d->matchesAffinity(dw->affinities))
-            continue;
+    if (step < layout.allDockWidgets.size()) {
+        KDDW_TRACE_SCOPE("restore", "restorePlaceholders");
+        const auto &dw = layout.allDockWidgets.at(step);
+        if (!matchesAffinity(dw->affinities))
+            return true;
 
-        if (DockWidgetBase *dockWidget = d->m_dockRegistry->dockByName(dw->uniqueName)) {
+        if (DockWidgetBase *dockWidget = m_dockRegistry->dockByName(dw->uniqueName)) {
             dockWidget->lastPositions().deserialize(dw->lastPosition);
         } else {
             qWarning() << Q_FUNC_INFO << "Couldn't find dock widget" << dw->uniqueName;
         }
+
+        return true;
     }
 
-    return true;
+    qWarning() << Q_FUNC_INFO << "Invalid restore step" << step;
+    return false;
 }
 
-void LayoutSaver::setAffinityNames(const QStringList &affinityNames)
+void LayoutSaver::Private::applyDeferredVisibility()
 {
-    d->m_affinityNames = affinityNames;
-    if (affinityNames.contains(QString())) {
-        // Any window with empty affinity will also be subject to save/restore
-        d->m_affinityNames << QString();
+    const auto deferredVisibility = m_deferredVisibility;
+    m_deferredVisibility.clear();
+    for (const auto &pair : deferredVisibility) {
+        if (QWidgetOrQuick *topLevel = pair.first)
+            topLevel->setVisible(pair.second);
     }
-}
 
-DockWidgetBase::List LayoutSaver::restoredDockWidgets() const
-{
-    const DockWidgetBase::List &allDockWidgets = DockRegistry::self()->dockwidgets();
-    DockWidgetBase::List result;
-    result.reserve(allDockWidgets.size());
-    for (DockWidgetBase *dw : allDockWidgets) {
-        if (dw->property("kddockwidget_was_restored").toBool())
-            result.push_back(dw);
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+    const auto frozenWindows = m_frozenWindows;
+    m_frozenWindows.clear();
+    for (QWidget *window : frozenWindows) {
+        if (window)
+            window->setUpdatesEnabled(true);
     }
-
-    return result;
+#endif
 }
 
-void LayoutSaver::Private::clearRestoredProperty()
+void LayoutSaver::Private::syncLayoutSizes()
 {
-    const DockWidgetBase::List &allDockWidgets = DockRegistry::self()->dockwidgets();
-    for (DockWidgetBase *dw : allDockWidgets) {
-        dw->setProperty("kddockwidget_was_restored", QVariant());
+    for (MultiSplitter *layout : m_dockRegistry->layouts()) {
+        const QSize windowSize = layout->QWidgetAdapter::size();
+        if (layout->size() != windowSize)
+            layout->setLayoutSize(windowSize);
     }
 }
 
-template <typename T>
-void LayoutSaver::Private::deserializeWindowGeometry(const T &saved, QWidgetOrQuick *topLevel)
-{
-    topLevel->setGeometry(saved.geometry);
-    topLevel->setVisible(saved.isVisible);
-}
-
 void LayoutSaver::Private::deleteEmptyFrames()
 {
     // After a restore it can happen that some DockWidgets didn't exist, so weren't restored.
@@ -358,6 +628,144 @@ bool LayoutSaver::restoreInProgress()
     return Private::s_restoreInProgress;
 }
 
+LayoutRestoreJob::LayoutRestoreJob(RestoreOptions options, int timeSliceMs)
+    : QObject()
+    , d(new Private(options, timeSliceMs))
+{
+    d->timer.setInterval(0);
+    connect(&d->timer, &QTimer::timeout, this, &LayoutRestoreJob::restoreNextChunk);
+}
+
+LayoutRestoreJob::~LayoutRestoreJob()
+{
+    if (d->parser)
+        d->parser->wait();
+
+    if (!d->finished)
+        cleanup();
+
+    delete d;
+}
+
+int LayoutRestoreJob::stepsDone() const
+{
+    return d->stepsDone;
+}
+
+int LayoutRestoreJob::stepsTotal() const
+{
+    return d->stepsTotal;
+}
+
+bool LayoutRestoreJob::isFinished() const
+{
+    return d->finished;
+}
+
+void LayoutRestoreJob::start(const QByteArray &data)
+{
+    d->saver.d->clearRestoredProperty();
+
+    if (data.isEmpty()) {
+        QTimer::singleShot(0, this, [this] { finish(true); });
+        return;
+    }
+
+    d->parser = new JsonParserThread(data, this);
+    connect(d->parser.data(), &QThread::finished, this, &LayoutRestoreJob::onJsonParsed);
+    d->parser->start();
+}
+
+void LayoutRestoreJob::onJsonParsed()
+{
+    JsonParserThread *parser = d->parser;
+    d->parser = nullptr;
+    parser->deleteLater();
+
+    if (!parser->m_success) {
+        qWarning() << Q_FUNC_INFO << "Failed to parse json data";
+        finish(false);
+        return;
+    }
+
+    d->layout.fromVariantMap(parser->m_map);
+    d->saver.d->m_deferVisibility = true;
+    bool prepared;
+    {
+        LayoutSaver::Private::RAIIIsRestoring isRestoring;
+        prepared = d->saver.d->prepareRestore(d->layout);
+    }
+
+    if (!prepared) {
+        finish(false);
+        return;
+    }
+
+    d->stepsTotal = LayoutSaver::Private::restoreStepCount(d->layout);
+    Q_EMIT progressChanged(0, d->stepsTotal);
+
+    if (d->stepsTotal == 0)
+        finish(true);
+    else
+        d->timer.start();
+}
+
+void LayoutRestoreJob::restoreNextChunk()
+{
+    KDDW_TRACE_SCOPE("restore", "LayoutRestoreJob::restoreNextChunk");
+    {
+        // Only while restoring, so window resizes between chunks still reach the layouts
+        LayoutSaver::Private::RAIIIsRestoring isRestoring;
+        if (!restoreChunk()) {
+            finish(false);
+            return;
+        }
+    }
+
+    Q_EMIT progressChanged(d->stepsDone, d->stepsTotal);
+
+    if (d->stepsDone == d->stepsTotal)
+        finish(true);
+}
+
+bool LayoutRestoreJob::restoreChunk()
+{
+    // Always do at least one step, and then as many as fit in the time slice
+    QElapsedTimer elapsed;
+    elapsed.start();
+    do {
+        if (!d->saver.d->restoreStep(d->layout, d->stepsDone))
+            return false;
+        ++d->stepsDone;
+    } while (d->stepsDone < d->stepsTotal && elapsed.elapsed() < d->timeSliceMs);
+
+    return true;
+}
+
+void LayoutRestoreJob::cleanup()
+{
+    d->timer.stop();
+    {
+        LayoutSaver::Private::RAIIIsRestoring isRestoring;
+        d->saver.d->deleteEmptyFrames();
+    }
+
+    // The windows might have been resized while steps were running
+    d->saver.d->syncLayoutSizes();
+    d->saver.d->applyDeferredVisibility();
+}
+
+void LayoutRestoreJob::finish(bool success)
+{
+    if (d->finished)
+        return;
+
+    cleanup();
+    d->finished = true;
+    Q_EMIT finished(success);
+    deleteLater();
+}
+
 bool LayoutSaver::Layout::isValid() const
 {
     if (serializationVersion != KDDOCKWIDGETS_SERIALIZATION_VERSION) {
@@ -392,6 +800,7 @@ QByteArray LayoutSaver::Layout::toJson() const
 
 bool LayoutSaver::Layout::fromJson(const QByteArray &jsonData)
 {
+    KDDW_TRACE_SCOPE("restore", "LayoutSaver::Layout::fromJson");
     QJsonParseError error;
     QJsonDocument doc = QJsonDocument::fromJson(jsonData, &error);
     if (error.error == QJsonParseError::NoError)  {
@@ -574,6 +983,20 @@ void LayoutSaver::Frame::fromVariantMap(const QVariantMap &map)
     }
 }
 
+LayoutSaver::DockWidget::Ptr LayoutSaver::DockWidget::dockWidgetForName(const QString &name)
+{
+    QHash<QString, Ptr> &dockWidgets = s_privateDockWidgets ? *s_privateDockWidgets : s_dockWidgets;
+    auto dw = dockWidgets.value(name);
+    if (dw)
+        return dw;
+
+    dw = Ptr(new LayoutSaver::DockWidget);
+    dockWidgets.insert(name, dw);
+    dw->uniqueName = name;
+
+    return dw;
+}
+
 bool LayoutSaver::DockWidget::isValid() const
 {
     return !uniqueName.isEmpty();
@@ -23,6 +23,8 @@
 
 #include "KDDockWidgets.h"
 
+#include <QObject>
+
 QT_BEGIN_NAMESPACE
 class QByteArray;
 QT_END_NAMESPACE
@@ -30,6 +32,7 @@ QT_END_NAMESPACE
 namespace KDDockWidgets {
 
 class DockWidgetBase;
+class LayoutRestoreJob;
 
 class DOCKS_EXPORT LayoutSaver
 {
@@ -76,6 +79,35 @@ public:
      */
     bool restoreLayout(const QByteArray &);
 
+    /**
+     * @brief restores the layout from a byte array, incrementally
+     *
+     * Like @ref restoreLayout(), but the JSON is parsed in a worker thread and the windows are then
+     * restored in chunks of at most @p timeSliceMs, one chunk per event loop iteration, so the UI
+     * doesn't freeze while restoring big layouts. Top-level windows are only shown once the whole
+     * layout is restored.
+     *
+     * Main windows that are already visible don't repaint until the restore finishes.
+     * The returned job emits LayoutRestoreJob::finished() when done and then deletes itself.
+     * @ref restoreInProgress() is only true while a chunk is being restored, so window resizes in
+     * between are still applied. Don't save or restore layouts until the job finishes.
+     */
+    LayoutRestoreJob *restoreLayoutAsync(const QByteArray &, int timeSliceMs = 10);
+
+    /**
+     * @brief checks whether a serialized layout can be restored, without restoring it
+     *
+     * Parses the JSON, checks the saved windows, frames and dock widgets and replays each
+     * saved splitter tree on a headless layout to verify its geometries. No widgets are created.
+     * The reasons a layout is invalid are reported via qWarning().
+     *
+     * The parsed state is private to the call and none of LayoutSaver's global state is written,
+     * so it can run in worker threads, concurrently with other validations and with the GUI thread
+     * saving or restoring layouts. A QGuiApplication must exist.
+     * @return true if the layout is valid
+     */
+    static bool validateLayout(const QByteArray &);
+
     /**
      * @brief returns a list of dock widgets which were restored since the last
      * @ref restoreLayout() or @ref restoreFromFile()
@@ -106,6 +138,45 @@ public:
 private:
     Q_DISABLE_COPY(LayoutSaver)
     friend class TestDocks;
+    friend class LayoutRestoreJob;
+
+    class Private;
+    Private *const d;
+};
+
+///@brief An incremental restore started with @ref LayoutSaver::restoreLayoutAsync()
+class DOCKS_EXPORT LayoutRestoreJob : public QObject
+{
+    Q_OBJECT
+public:
+    ///@brief Destructor. Deleting the job before it finishes leaves the layout partially restored
+    ~LayoutRestoreJob() override;
+
+    ///@brief returns the number of restore steps already done
+    int stepsDone() const;
+
+    ///@brief returns the total number of restore steps, 0 while the JSON is still being parsed
+    int stepsTotal() const;
+
+    ///@brief returns whether the restore finished, successfully or not
+    bool isFinished() const;
+
+Q_SIGNALS:
+    ///@brief emitted after each chunk of restore steps
+    void progressChanged(int stepsDone, int stepsTotal);
+
+    ///@brief emitted once the restore is done. The job is deleted afterwards.
+    void finished(bool success);
+
+private:
+    friend class LayoutSaver;
+    explicit LayoutRestoreJob(RestoreOptions options, int timeSliceMs);
+    void start(const QByteArray &data);
+    void onJsonParsed();
+    void restoreNextChunk();
+    bool restoreChunk();
+    void cleanup();
+    void finish(bool success);
 
     class Private;
     Private *const d;
@@ -124,18 +124,9 @@ struct DOCKS_EXPORT LayoutSaver::DockWidget
     /// Iterates through the layout and patches all absolute sizes. See RestoreOption_RelativeToMainWindow.
     void scaleSizes(const ScalingInfo &scalingInfo);
 
-    static Ptr dockWidgetForName(const QString &name)
-    {
-        auto dw = s_dockWidgets.value(name);
-        if (dw)
-            return dw;
-
-        dw = Ptr(new LayoutSaver::DockWidget);
-        s_dockWidgets.insert(name, dw);
-        dw->uniqueName = name;
-
-        return dw;
-    }
+    ///@brief returns the shared instance for dock widget @p name, creating it if needed.
+    ///Uses the private table of the current thread instead, while one is set, see LayoutSaver::validateLayout()
+    static Ptr dockWidgetForName(const QString &name);
 
     QVariantMap toVariantMap() const;
     void fromVariantMap(const QVariantMap &map);
@@ -267,7 +258,13 @@ struct LayoutSaver::Layout
 {
 public:
 
-    Layout() {
+    ///@brief @p isBeingRestored is false for layouts which are only parsed and checked, see
+    ///LayoutSaver::validateLayout(). Those don't set s_currentLayoutBeingRestored nor query the
+    ///screens, so they can be used outside of the GUI thread.
+    explicit Layout(bool isBeingRestored = true) {
+        if (!isBeingRestored)
+            return;
+
         s_currentLayoutBeingRestored = this;
 
         const QList<QScreen*> screens = qApp->screens();
@@ -282,7 +279,8 @@ public:
     }
 
     ~Layout() {
-        s_currentLayoutBeingRestored = nullptr;
+        if (s_currentLayoutBeingRestored == this)
+            s_currentLayoutBeingRestored = nullptr;
     }
 
     bool isValid() const;
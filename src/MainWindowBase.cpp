@@ -25,6 +25,8 @@
 #include "Logging_p.h"
 #include "DropAreaWithCentralFrame_p.h"
 
+#include <QSet>
+
 using namespace KDDockWidgets;
 
 class MainWindowBase::Private
@@ -63,7 +65,7 @@ MainWindowBase::~MainWindowBase()
     delete d;
 }
 
-void MainWindowBase::addDockWidgetAsTab(DockWidgetBase *widget)
+void MainWindowBase::addDockWidgetAsTab(DockWidgetBase *widget, AddingOption addingOption)
 {
     Q_ASSERT(widget);
     qCDebug(addwidget) << Q_FUNC_INFO << widget;
@@ -80,7 +82,7 @@ void MainWindowBase::addDockWidgetAsTab(DockWidgetBase *widget)
     }
 
     if (d->supportsCentralFrame()) {
-        dropArea()->m_centralFrame->addWidget(widget);
+        dropArea()->m_centralFrame->addWidget(widget, addingOption);
     } else {
         qWarning() << Q_FUNC_INFO << "Not supported without MainWindowOption_HasCentralFrame";
     }
@@ -96,6 +98,112 @@ void MainWindowBase::addDockWidget(DockWidgetBase *dw, Location location, DockWi
     dropArea()->addDockWidget(dw, location, relativeTo, option);
 }
 
+/// Returns Location_None for "center" and for invalid strings, @p ok tells them apart
+static Location locationFromStr(const QString &str, bool *ok)
+{
+    *ok = true;
+    for (Location loc : { Location_OnLeft, Location_OnTop, Location_OnRight, Location_OnBottom }) {
+        if (str == locationStr(loc))
+            return loc;
+    }
+
+    *ok = str == QLatin1String("center");
+    return Location_None;
+}
+
+bool MainWindowBase::addDockWidgets(const QVariantList &description)
+{
+    struct Entry {
+        DockWidgetBase *dockWidget;
+        Location location;
+        DockWidgetBase *relativeTo;
+        DockWidgetBase *tabbedWith;
+        AddingOption option;
+    };
+
+    DockRegistry *registry = DockRegistry::self();
+    QVector<Entry> entries;
+    entries.reserve(description.size());
+    QSet<DockWidgetBase *> described;
+
+    // Validate everything first, so a bad description doesn't leave a half built layout behind
+    auto findTarget = [registry, &described, this] (const QVariantMap &map, const QString &key, DockWidgetBase **target) {
+        *target = nullptr;
+        const QString name = map.value(key).toString();
+        if (name.isEmpty())
+            return true;
+
+        *target = registry->dockByName(name);
+        if (!*target || (!described.contains(*target) && !dropArea()->contains(*target))) {
+            qWarning() << Q_FUNC_INFO << "Invalid" << key << name;
+            return false;
+        }
+
+        return true;
+    };
+
+    for (const QVariant &v : description) {
+        const QVariantMap map = v.toMap();
+        const QString name = map.value(QStringLiteral("name")).toString();
+        DockWidgetBase *dw = registry->dockByName(name);
+        if (!dw) {
+            qWarning() << Q_FUNC_INFO << "Unknown dock widget" << name;
+            return false;
+        }
+
+        if (described.contains(dw)) {
+            qWarning() << Q_FUNC_INFO << "Dock widget described twice" << name;
+            return false;
+        }
+
+        if (dw->options() & DockWidgetBase::Option_NotDockable) {
+            qWarning() << Q_FUNC_INFO << "Refusing to dock non-dockable widget" << dw;
+            return false;
+        }
+
+        Entry entry;
+        entry.dockWidget = dw;
+        entry.option = map.value(QStringLiteral("startHidden")).toBool() ? AddingOption_StartHidden
+                                                                         : AddingOption_None;
+        if (!findTarget(map, QStringLiteral("relativeTo"), &entry.relativeTo) ||
+            !findTarget(map, QStringLiteral("tabbedWith"), &entry.tabbedWith))
+            return false;
+
+        if (entry.relativeTo == dw || entry.tabbedWith == dw) {
+            qWarning() << Q_FUNC_INFO << "Dock widget can't be relative to itself" << name;
+            return false;
+        }
+
+        bool ok = false;
+        entry.location = locationFromStr(map.value(QStringLiteral("location")).toString(), &ok);
+        if (!entry.tabbedWith) {
+            if (!ok) {
+                qWarning() << Q_FUNC_INFO << "Invalid location for" << name << map.value(QStringLiteral("location"));
+                return false;
+            }
+
+            if (entry.location == Location_None && !d->supportsCentralFrame()) {
+                qWarning() << Q_FUNC_INFO << "center requires MainWindowOption_HasCentralFrame";
+                return false;
+            }
+        }
+
+        described.insert(dw);
+        entries.push_back(entry);
+    }
+
+    for (const Entry &entry : qAsConst(entries)) {
+        if (entry.tabbedWith)
+            entry.tabbedWith->addDockWidgetAsTab(entry.dockWidget, entry.option);
+        else if (entry.location == Location_None)
+            addDockWidgetAsTab(entry.dockWidget, entry.option);
+        else
+            addDockWidget(entry.dockWidget, entry.location, entry.relativeTo, entry.option);
+    }
+
+    return true;
+}
+
 QString MainWindowBase::uniqueName() const
 {
     return d->name;
@@ -25,6 +25,7 @@
 #include "QWidgetAdapter.h"
 #include "LayoutSaver_p.h"
 
+#include <QVariant>
 #include <QVector>
 
 namespace KDDockWidgets {
@@ -60,10 +61,12 @@ public:
      * @brief Docks a DockWidget into the central frame, tabbed.
      * @warning Requires that the MainWindow was constructed with MainWindowOption_HasCentralFrame option.
      * @param dockwidget The dockwidget to dock.
+     * @param addingOption Allows to add the dock widget as hidden, recording only a placeholder in
+     * the central frame. So it's restored there when eventually shown.
      *
      * @sa DockWidgetBase::addDockWidgetAsTab()
      */
-    void addDockWidgetAsTab(DockWidgetBase *dockwidget);
+    void addDockWidgetAsTab(DockWidgetBase *dockwidget, AddingOption addingOption = AddingOption_None);
 
     /**
      * @brief Docks a DockWidget into this main window.
@@ -76,6 +79,25 @@ public:
                        KDDockWidgets::Location location,
                        DockWidgetBase *relativeTo = nullptr, AddingOption option = KDDockWidgets::AddingOption());
 
+    /**
+     * @brief Docks many dock widgets at once, as described by @p description.
+     *
+     * Each entry is a QVariantMap with:
+     * - "name": the unique name of an existing dock widget. Required.
+     * - "location": "left", "top", "right", "bottom", or "center" for the central frame.
+     * - "relativeTo": optional unique name of a dock widget already in this main window or
+     *   earlier in @p description.
+     * - "tabbedWith": unique name of a docked dock widget, adds as a tab of it instead of using "location".
+     * - "startHidden": optional bool, see AddingOption_StartHidden.
+     *
+     * The entries are applied in order. The whole description is checked first, nothing is
+     * docked if any entry is invalid. Meant for language bindings, which would otherwise pay a
+     * binding call per addDockWidget().
+     *
+     * @return true on success. Reasons for failure are reported via qWarning()
+     */
+    bool addDockWidgets(const QVariantList &description);
+
     /**
      * @brief Returns the unique name that was passed via constructor.
      *        Used internally by the save/restore mechanism.
@@ -0,0 +1,98 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Statistics.h"
+#include "DockRegistry_p.h"
+#include "DragController_p.h"
+#include "MainWindowBase.h"
+#include "MultiSplitter_p.h"
+#include "multisplitter/Item_p.h"
+#include "multisplitter/Widget.h"
+
+#include <QGuiApplication>
+#include <QWindow>
+
+using namespace KDDockWidgets;
+
+Statistics Statistics::snapshot()
+{
+    DockRegistry *registry = DockRegistry::self();
+    Statistics stats;
+
+    const QVector<MultiSplitter*> layouts = registry->layouts();
+    stats.layouts.reserve(layouts.size());
+    for (MultiSplitter *layout : layouts) {
+        Layouting::ItemContainer *root = layout->rootItem();
+        Layout layoutStats;
+        MainWindowBase *mainWindow = layout->mainWindow();
+        layoutStats.name = mainWindow ? mainWindow->uniqueName() : QStringLiteral("FloatingWindow");
+        layoutStats.numItems = layout->count();
+        layoutStats.numPlaceholders = layout->placeholderCount();
+        layoutStats.numContainers = root->containerCount_recursive();
+        layoutStats.numSeparators = root->separators_recursive().size();
+        stats.layouts.push_back(layoutStats);
+    }
+
+    stats.numDockWidgets = registry->dockwidgets().size();
+    stats.numHibernatedDockWidgets = registry->hibernatedDockwidgets().size();
+    stats.numMainWindows = registry->mainwindows().size();
+    stats.numFloatingWindows = registry->nestedwindows().size();
+    stats.numFrames = registry->frames().size();
+
+    const QWindowList windows = QGuiApplication::allWindows();
+    for (QWindow *window : windows) {
+        if (window->handle())
+            stats.numNativeWindows++;
+    }
+
+    stats.numGuestGeometryChanges = Layouting::Item::guestGeometryChangeCount();
+    stats.numRelayouts = Layouting::ItemContainer::relayoutCount();
+    stats.numHovers = DragController::instance()->hoverCount();
+    stats.numSolverAllocations = Layouting::ItemContainer::solverAllocationCount();
+    stats.numSizeConstraintsComputations = Layouting::Widget::sizeConstraintsComputationCount();
+    stats.numSolvedGeometryCacheHits = Layouting::ItemContainer::solvedGeometryCacheHits();
+    stats.numSolvedGeometryCacheMisses = Layouting::ItemContainer::solvedGeometryCacheMisses();
+
+    return stats;
+}
+
+QVariantMap Statistics::toVariantMap() const
+{
+    QVariantList layoutsV;
+    layoutsV.reserve(layouts.size());
+    for (const Layout &layout : layouts) {
+        QVariantMap layoutV;
+        layoutV.insert(QStringLiteral("name"), layout.name);
+        layoutV.insert(QStringLiteral("numItems"), layout.numItems);
+        layoutV.insert(QStringLiteral("numPlaceholders"), layout.numPlaceholders);
+        layoutV.insert(QStringLiteral("numContainers"), layout.numContainers);
+        layoutV.insert(QStringLiteral("numSeparators"), layout.numSeparators);
+        layoutsV.push_back(layoutV);
+    }
+
+    QVariantMap map;
+    map.insert(QStringLiteral("layouts"), layoutsV);
+    map.insert(QStringLiteral("numDockWidgets"), numDockWidgets);
+    map.insert(QStringLiteral("numHibernatedDockWidgets"), numHibernatedDockWidgets);
+    map.insert(QStringLiteral("numMainWindows"), numMainWindows);
+    map.insert(QStringLiteral("numFloatingWindows"), numFloatingWindows);
+    map.insert(QStringLiteral("numFrames"), numFrames);
+    map.insert(QStringLiteral("numNativeWindows"), numNativeWindows);
+    map.insert(QStringLiteral("numGuestGeometryChanges"), numGuestGeometryChanges);
+    map.insert(QStringLiteral("numRelayouts"), numRelayouts);
+    map.insert(QStringLiteral("numHovers"), numHovers);
+    map.insert(QStringLiteral("numSolverAllocations"), numSolverAllocations);
+    map.insert(QStringLiteral("numSizeConstraintsComputations"), numSizeConstraintsComputations);
+    map.insert(QStringLiteral("numSolvedGeometryCacheHits"), numSolvedGeometryCacheHits);
+    map.insert(QStringLiteral("numSolvedGeometryCacheMisses"), numSolvedGeometryCacheMisses);
+
+    return map;
+}
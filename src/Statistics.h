@@ -0,0 +1,76 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+/**
+ * @file
+ * @brief Runtime statistics, to monitor the framework in long running sessions.
+ *
+ * @author Sérgio Martins \<sergio.martins@kdab.com\>
+ */
+
+#ifndef KD_DOCKWIDGETS_STATISTICS_H
+#define KD_DOCKWIDGETS_STATISTICS_H
+
+#include "docks_export.h"
+
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+namespace KDDockWidgets
+{
+
+/**
+ * @brief A snapshot of the framework's runtime counters. See @ref snapshot().
+ *
+ * The counts of live objects describe the moment of the snapshot, while the activity counters
+ * accumulate since startup. Diff two snapshots to get rates.
+ */
+struct DOCKS_EXPORT Statistics
+{
+    ///@brief The counters of a single layout, which belongs to a main window or floating window
+    struct Layout
+    {
+        QString name; ///< The main window's unique name, or "FloatingWindow"
+        int numItems = 0; ///< Including placeholders
+        int numPlaceholders = 0;
+        int numContainers = 0;
+        int numSeparators = 0;
+    };
+
+    ///@brief Takes a snapshot of the current counters
+    static Statistics snapshot();
+
+    ///@brief Returns the counters as a QVariantMap, suitable for logging or telemetry
+    QVariantMap toVariantMap() const;
+
+    QVector<Layout> layouts;
+
+    int numDockWidgets = 0;
+    int numHibernatedDockWidgets = 0;
+    int numMainWindows = 0;
+    int numFloatingWindows = 0;
+    int numFrames = 0;
+    int numNativeWindows = 0; ///< QWindows with a platform window, including ones not created by us
+
+    // The activity counters are 64-bit, so long sessions don't overflow them
+    qint64 numGuestGeometryChanges = 0; ///< Times a frame got its geometry set by the layout
+    qint64 numRelayouts = 0; ///< Times a whole layout was resized
+    qint64 numHovers = 0; ///< Hover computations while dragging
+    qint64 numSolverAllocations = 0; ///< Sizing lists allocated by the layouting solver
+    qint64 numSizeConstraintsComputations = 0; ///< See Config::Flag_CoalesceSizeConstraints
+    qint64 numSolvedGeometryCacheHits = 0; ///< See Config::setSolvedGeometryCacheSize()
+    qint64 numSolvedGeometryCacheMisses = 0;
+};
+
+}
+
+#endif
@@ -9,6 +9,13 @@
   Contact KDAB at <info@kdab.com> for commercial licensing options.
 */
 
+/**
+ * Validates saved layouts.
+ *
+ * By default the files are checked in parallel with LayoutSaver::validateLayout(), which doesn't
+ * create any widget. --full restores each file into real windows instead, one after the other.
+ */
+
 #include "Config.h"
 
 #ifdef KDDOCKWIDGETS_QTQUICK
@@ -20,12 +27,38 @@
 #endif
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QDebug>
+#include <QFile>
+#include <QMutex>
+#include <QRunnable>
 #include <QString>
+#include <QThread>
+#include <QThreadPool>
+
+#include <iostream>
 
 using namespace KDDockWidgets;
 
-static bool lint(const QString &filename)
+struct LintResult {
+    QString filename;
+    bool valid = false;
+    QStringList messages;
+};
+
+// Messages of the file being linted by the current thread, so they're printed next to its result
+static thread_local QStringList *s_capturedMessages = nullptr;
+static QtMessageHandler s_previousMessageHandler = nullptr;
+
+static void messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    if (s_capturedMessages)
+        s_capturedMessages->push_back(msg);
+    else if (s_previousMessageHandler)
+        s_previousMessageHandler(type, context, msg);
+}
+
+static bool restoreFile(const QString &filename)
 {
     DockWidgetFactoryFunc dwFunc = [] (const QString &dwName) {
         return static_cast<DockWidgetBase*>(new DockWidgetType(dwName));
@@ -42,14 +75,116 @@ static bool lint(const QString &filename)
     return restorer.restoreFromFile(filename);
 }
 
+static bool validateFile(const QString &filename)
+{
+    QFile f(filename);
+    if (!f.open(QIODevice::ReadOnly)) {
+        qWarning() << "Failed to open" << filename << f.errorString();
+        return false;
+    }
+
+    return LayoutSaver::validateLayout(f.readAll());
+}
+
+static void lint(LintResult &result, bool full)
+{
+    s_capturedMessages = &result.messages;
+    result.valid = full ? restoreFile(result.filename) : validateFile(result.filename);
+    s_capturedMessages = nullptr;
+}
+
+class LintTask : public QRunnable
+{
+public:
+    explicit LintTask(LintResult &result)
+        : m_result(result)
+    {
+    }
+
+    void run() override
+    {
+        lint(m_result, /*full=*/ false);
+    }
+
+private:
+    LintResult &m_result;
+};
+
 int main(int argc, char *argv[])
 {
+    bool qpaPassed = false;
+    for (int i = 1; i < argc; ++i) {
+        if (qstrcmp(argv[i], "-platform") == 0) {
+            qpaPassed = true;
+            break;
+        }
+    }
+
+    if (!qpaPassed && qgetenv("QT_QPA_PLATFORM").isEmpty()) {
+        // Nothing needs to be shown, don't require a display
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
     QApplication app(argc, argv);
 
-    if (app.arguments().size() != 2) {
-        qDebug() << "Usage: kddockwidgets_linter <layout json file>";
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Validates KDDockWidgets layout files");
+    parser.addPositionalArgument("files", QCoreApplication::translate("main", "Layout json files"), "<file>...");
+
+    QCommandLineOption jobsOption("j", QCoreApplication::translate("main", "Number of files validated in parallel"),
+                                  "jobs", QString::number(QThread::idealThreadCount()));
+    parser.addOption(jobsOption);
+
+    QCommandLineOption fullOption("full", QCoreApplication::translate("main", "Restore each file into real windows, serially"));
+    parser.addOption(fullOption);
+
+    parser.addHelpOption();
+    parser.process(app);
+
+    const QStringList files = parser.positionalArguments();
+    if (files.isEmpty()) {
+        qDebug() << "Usage: kddockwidgets_linter [-j <jobs>] [--full] <layout json file>...";
+        return 1;
+    }
+
+    bool ok = false;
+    const int numJobs = parser.value(jobsOption).toInt(&ok);
+    if (!ok || numJobs < 1) {
+        qDebug() << "Invalid number of jobs" << parser.value(jobsOption);
         return 1;
     }
 
-    return lint(app.arguments().at(1)) ? 0 : 2;
+    QVector<LintResult> results(files.size());
+    for (int i = 0; i < files.size(); ++i)
+        results[i].filename = files.at(i);
+
+    s_previousMessageHandler = qInstallMessageHandler(messageHandler);
+
+    if (parser.isSet(fullOption)) {
+        // Creates widgets, so it must stay in the GUI thread
+        for (LintResult &result : results)
+            lint(result, /*full=*/ true);
+    } else {
+        QThreadPool pool;
+        pool.setMaxThreadCount(numJobs);
+        for (LintResult &result : results)
+            pool.start(new LintTask(result));
+        pool.waitForDone();
+    }
+
+    qInstallMessageHandler(s_previousMessageHandler);
+
+    int numInvalid = 0;
+    for (const LintResult &result : qAsConst(results)) {
+        std::cout << (result.valid ? "OK   " : "FAIL ") << qPrintable(result.filename) << "\n";
+        if (!result.valid) {
+            ++numInvalid;
+            for (const QString &message : result.messages)
+                std::cout << "    " << qPrintable(message) << "\n";
+        }
+    }
+
+    std::cout << results.size() - numInvalid << " valid, " << numInvalid << " invalid\n";
+
+    return numInvalid == 0 ? 0 : 2;
 }
@@ -37,6 +37,7 @@
 #include <QFileDialog>
 #include <QAbstractNativeEventFilter>
 #include <QTimer>
+#include <QLabel>
 
 #ifdef Q_OS_WIN
 # include <Windows.h>
@@ -80,11 +81,20 @@ DebugAppEventFilter::~DebugAppEventFilter() {}
 DebugWindow::DebugWindow(QWidget *parent)
     : QWidget(parent)
     , m_objectViewer(this)
+    , m_statisticsLabel(new QLabel(this))
+    , m_lastStatistics(Statistics::snapshot())
 {
     // qApp->installNativeEventFilter(new DebugAppEventFilter());
     auto layout = new QVBoxLayout(this);
     layout->addWidget(&m_objectViewer);
 
+    m_statisticsLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    layout->addWidget(m_statisticsLabel);
+    auto statisticsTimer = new QTimer(this);
+    connect(statisticsTimer, &QTimer::timeout, this, &DebugWindow::updateStatistics);
+    statisticsTimer->start(1000);
+    updateStatistics();
+
     auto button = new QPushButton(this);
     button->setText(QStringLiteral("Dump Debug"));
     layout->addWidget(button);
@@ -296,6 +306,35 @@ void DebugWindow::dumpWindows()
 
 #endif
 
+void DebugWindow::updateStatistics()
+{
+    const Statistics stats = Statistics::snapshot();
+
+    QString text = QStringLiteral("DockWidgets: %1 (%2 hibernated); MainWindows: %3; FloatingWindows: %4; Frames: %5; Native windows: %6\n")
+                   .arg(stats.numDockWidgets).arg(stats.numHibernatedDockWidgets).arg(stats.numMainWindows)
+                   .arg(stats.numFloatingWindows).arg(stats.numFrames).arg(stats.numNativeWindows);
+
+    for (const Statistics::Layout &layout : stats.layouts) {
+        text += QStringLiteral("  %1: %2 items (%3 placeholders), %4 containers, %5 separators\n")
+                .arg(layout.name).arg(layout.numItems).arg(layout.numPlaceholders)
+                .arg(layout.numContainers).arg(layout.numSeparators);
+    }
+
+    // The timer fires every second, so the deltas are per second
+    text += QStringLiteral("Per second: %1 relayouts, %2 guest geometry changes, %3 hovers, %4 solver allocations, %5 size constraint computations\n")
+            .arg(stats.numRelayouts - m_lastStatistics.numRelayouts)
+            .arg(stats.numGuestGeometryChanges - m_lastStatistics.numGuestGeometryChanges)
+            .arg(stats.numHovers - m_lastStatistics.numHovers)
+            .arg(stats.numSolverAllocations - m_lastStatistics.numSolverAllocations)
+            .arg(stats.numSizeConstraintsComputations - m_lastStatistics.numSizeConstraintsComputations);
+
+    text += QStringLiteral("Solved geometry cache: %1 hits, %2 misses")
+            .arg(stats.numSolvedGeometryCacheHits).arg(stats.numSolvedGeometryCacheMisses);
+
+    m_statisticsLabel->setText(text);
+    m_lastStatistics = stats;
+}
+
 void DebugWindow::repaintWidgetRecursive(QWidget *w)
 {
     w->repaint();
@@ -19,10 +19,12 @@
 #define DEBUGWINDOW_H
 
 #include "ObjectViewer_p.h"
+#include "Statistics.h"
 #include <QWidget>
 
 QT_BEGIN_NAMESPACE
 class QEventLoop;
+class QLabel;
 QT_END_NAMESPACE
 
 namespace KDDockWidgets {
@@ -43,8 +45,14 @@ private:
     void repaintWidgetRecursive(QWidget *);
 
     void dumpDockWidgetInfo();
+
+    ///@brief Refreshes the counters panel. Activity counters are shown per second.
+    void updateStatistics();
+
     ObjectViewer m_objectViewer;
     QEventLoop *m_isPickingWidget = nullptr;
+    QLabel *const m_statisticsLabel;
+    Statistics m_lastStatistics;
 
 protected:
     void mousePressEvent(QMouseEvent *event) override;
@@ -25,6 +25,7 @@
 # include "DebugWindow_p.h"
 #else
 # include "quick/QmlTypes.h"
+# include "multisplitter/Widget_quick.h"
 #endif
 
 using namespace KDDockWidgets;
@@ -373,11 +374,65 @@ const DockWidgetBase::List DockRegistry::closedDockwidgets() const
     return result;
 }
 
+const DockWidgetBase::List DockRegistry::hibernatedDockwidgets() const
+{
+    DockWidgetBase::List result;
+
+    for (DockWidgetBase *dw : m_dockWidgets) {
+        if (dw->isHibernated())
+            result.push_back(dw);
+    }
+
+    return result;
+}
+
+int DockRegistry::hibernatedQObjectCount() const
+{
+    int count = 0;
+    for (DockWidgetBase *dw : m_dockWidgets)
+        count += dw->hibernatedQObjectCount();
+
+    return count;
+}
+
 const MainWindowBase::List DockRegistry::mainwindows() const
 {
     return m_mainWindows;
 }
 
+bool DockRegistry::hasPendingLayoutWork() const
+{
+    for (MultiSplitter *layout : m_layouts) {
+        if (layout->hasPendingResize() || layout->rootItem()->hasPendingSizeConstraints())
+            return true;
+    }
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+    if (Layouting::Widget_quick::hasPendingGeometries())
+        return true;
+#endif
+
+    return false;
+}
+
+void DockRegistry::applyPendingLayoutWork()
+{
+    const QVector<MultiSplitter *> layouts = m_layouts; // copy, as applying can create or destroy layouts
+    for (MultiSplitter *layout : layouts) {
+        if (!m_layouts.contains(layout))
+            continue;
+
+        layout->applyPendingResize();
+        Layouting::ItemContainer *root = layout->rootItem();
+        if (root->hasPendingSizeConstraints())
+            root->processPendingSizeConstraints();
+    }
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+    Layouting::Widget_quick::applyPendingGeometries();
+#endif
+}
+
 const QVector<MultiSplitter *> DockRegistry::layouts() const
 {
     return m_layouts;
@@ -410,7 +465,8 @@ const QVector<QWindow *> DockRegistry::floatingWindows() const
             if (QWindow *window = fw->windowHandle()) {
                 window->setProperty("kddockwidgets_qwidget", QVariant::fromValue<QWidgetOrQuick*>(fw)); // Since QWidgetWindow is private API
                 windows.push_back(window);
-            } else {
+            } else if (fw->isVisible()) {
+                // Hidden ones are fine, with Config::Flag_OutlineDragging the native window is only created when shown
                 qWarning() << Q_FUNC_INFO << "FloatingWindow doesn't have QWindow";
             }
         }
@@ -68,6 +68,14 @@ public:
     ///@brief returns all closed DockWidget instances
     const DockWidgetBase::List closedDockwidgets() const;
 
+    ///@brief returns all DockWidget instances whose guest widget was released by hibernation
+    ///@sa DockWidgetBase::hibernate()
+    const DockWidgetBase::List hibernatedDockwidgets() const;
+
+    ///@brief returns how many QObjects the hibernated dock widgets released.
+    /// Only a proxy for the memory that hibernation is saving, it doesn't count bytes.
+    int hibernatedQObjectCount() const;
+
     ///@brief returns all MainWindow instances
     const MainWindowBase::List mainwindows() const;
 
@@ -138,6 +146,17 @@ public:
      */
     void checkSanityAll(bool dumpDebug = false);
 
+    /**
+     * @brief Returns whether any layout has deferred work not yet applied.
+     * That's a window resize deferred by Config::Flag_LazyWindowResize, size constraints
+     * coalesced by Config::Flag_CoalesceSizeConstraints or QtQuick geometries batched by
+     * Config::Flag_BatchGeometryUpdates.
+     */
+    bool hasPendingLayoutWork() const;
+
+    ///@brief Applies all deferred layout work now. See hasPendingLayoutWork()
+    void applyPendingLayoutWork();
+
     /**
      * @brief Returns whether we're processing a QEvent::Quit
      *
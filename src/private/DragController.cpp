@@ -18,6 +18,7 @@
 #include "Utils_p.h"
 #include "DockRegistry_p.h"
 #include "Qt5Qt6Compat_p.h"
+#include "multisplitter/Tracing_p.h"
 
 #include <QMouseEvent>
 #include <QApplication>
@@ -99,6 +100,7 @@ StateNone::StateNone(DragController *parent)
 void StateNone::onEntry(QEvent *)
 {
     qCDebug(state) << "StateNone entered";
+    KDDW_TRACE_INSTANT("drag", "StateNone");
     q->m_pressPos = QPoint();
     q->m_offset = QPoint();
     q->m_draggable = nullptr;
@@ -140,6 +142,7 @@ StatePreDrag::~StatePreDrag() = default;
 void StatePreDrag::onEntry(QEvent *)
 {
     qCDebug(state) << "StatePreDrag entered";
+    KDDW_TRACE_INSTANT("drag", "StatePreDrag");
     WidgetResizeHandler::s_disableAllHandlers = true; // Disable the resize handler during dragging
 }
 
@@ -167,6 +170,7 @@ StateDragging::~StateDragging() = default;
 
 void StateDragging::onEntry(QEvent *)
 {
+    KDDW_TRACE_SCOPE("drag", "StateDragging::onEntry");
     if (DockWidgetBase *dw = q->m_draggable->singleDockWidget()) {
         // When we start to drag a floating window which has a single dock widget, we save the position
         if (dw->isFloating())
@@ -186,6 +190,10 @@ void StateDragging::onEntry(QEvent *)
                 q->m_offset.setX(fw->width() / 2);
             }
         }
+
+        // With non-client drags it's the OS moving the window, so there's nothing to outline
+        if (KDDockWidgets::usesOutlineDragging() && !q->m_nonClientDrag)
+            q->m_windowBeingDragged->showOutline();
     } else {
         // Shouldn't happen
         qWarning() << Q_FUNC_INFO << "No window being dragged for " << q->m_draggable->asWidget();
@@ -196,6 +204,7 @@ void StateDragging::onEntry(QEvent *)
 bool StateDragging::handleMouseButtonRelease(QPoint globalPos)
 {
     qCDebug(state) << "StateDragging: handleMouseButtonRelease";
+    KDDW_TRACE_SCOPE("drag", "StateDragging::handleMouseButtonRelease");
 
     FloatingWindow *floatingWindow = q->m_windowBeingDragged->floatingWindow();
     if (!floatingWindow) {
@@ -207,6 +216,7 @@ bool StateDragging::handleMouseButtonRelease(QPoint globalPos)
 
     if (floatingWindow->anyNonDockable()) {
         qCDebug(state) << "StateDragging: Ignoring floating window with non dockable widgets";
+        q->m_windowBeingDragged->applyOutlineGeometry();
         Q_EMIT q->dragCanceled();
         return true;
     }
@@ -214,19 +224,23 @@ bool StateDragging::handleMouseButtonRelease(QPoint globalPos)
     if (q->m_currentDropArea) {
         if (q->m_currentDropArea->drop(floatingWindow, globalPos)) {
             Q_EMIT q->dropped();
+            return true;
         } else {
             qCDebug(state) << "StateDragging: Bailling out, drop not accepted";
-            Q_EMIT q->dragCanceled();
         }
     } else {
         qCDebug(state) << "StateDragging: Bailling out, not over a drop area";
-        Q_EMIT q->dragCanceled();
     }
+
+    // Not dropped. If only the outline was moving then the window goes there now.
+    q->m_windowBeingDragged->applyOutlineGeometry();
+    Q_EMIT q->dragCanceled();
     return true;
 }
 
 bool StateDragging::handleMouseMove(QPoint globalPos)
 {
+    KDDW_TRACE_SCOPE("drag", "StateDragging::handleMouseMove");
     FloatingWindow *fw = q->m_windowBeingDragged->floatingWindow();
     if (!fw) {
         qCDebug(state) << "Canceling drag, window was deleted";
@@ -239,8 +253,12 @@ bool StateDragging::handleMouseMove(QPoint globalPos)
         return true;
     }
 
-    if (!q->m_nonClientDrag)
-        fw->windowHandle()->setPosition(globalPos - q->m_offset);
+    if (!q->m_nonClientDrag) {
+        if (q->m_windowBeingDragged->outline())
+            q->m_windowBeingDragged->moveOutline(globalPos - q->m_offset);
+        else
+            fw->windowHandle()->setPosition(globalPos - q->m_offset);
+    }
 
 
     if (fw->anyNonDockable()) {
@@ -260,6 +278,8 @@ bool StateDragging::handleMouseMove(QPoint globalPos)
             }
         }
 
+        KDDW_TRACE_SCOPE("drag", "DropArea::hover");
+        q->m_numHovers++;
         dropArea->hover(fw, globalPos);
     }
 
@@ -292,6 +312,11 @@ DragController *DragController::instance()
     return &dragController;
 }
 
+qint64 DragController::hoverCount() const
+{
+    return m_numHovers;
+}
+
 void DragController::registerDraggable(Draggable *drg)
 {
     m_draggables << drg;
@@ -415,7 +440,8 @@ static QWidget *qtTopLevelForHWND(HWND hwnd)
 {
     auto topLevels = qApp->topLevelWidgets();
     for (auto topLevel : topLevels) {
-        if (hwnd == (HWND)topLevel->winId())
+        // internalWinId() so we don't force creating native windows for hidden top-levels
+        if (hwnd == (HWND)topLevel->internalWinId())
             return topLevel;
     }
 
@@ -458,7 +484,10 @@ WidgetType *DragController::qtTopLevelUnderCursor() const
 
         // There might be windows that don't belong to our app in between, so use win32 to travel by z-order.
         // Another solution is to set a parent on all top-levels. But this code is orthogonal.
-        HWND hwnd = HWND(m_windowBeingDragged->floatingWindow()->winId());
+        // With Flag_OutlineDragging the outline is on top instead, and the window might not even have a native handle yet
+        QWidgetOrQuick *draggedTopLevel = m_windowBeingDragged->outline() ? m_windowBeingDragged->outline()
+                                                                          : m_windowBeingDragged->floatingWindow();
+        HWND hwnd = HWND(draggedTopLevel->winId());
         while (hwnd) {
             hwnd = GetWindow(hwnd, GW_HWNDNEXT);
             RECT r;
@@ -469,6 +498,9 @@ WidgetType *DragController::qtTopLevelUnderCursor() const
                 continue;
 
             if (auto tl = qtTopLevelForHWND(hwnd)) {
+                if (tl == m_windowBeingDragged->floatingWindow()) // Stays put while its outline is dragged
+                    continue;
+
                 if (tl->geometry().contains(globalPos) && tl->objectName() != QStringLiteral("_docks_IndicatorWindow_Overlay")) {
                     qCDebug(toplevels) << Q_FUNC_INFO << "Found top-level" << tl;
                     return tl;
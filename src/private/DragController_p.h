@@ -50,6 +50,9 @@ public:
     void grabMouseFor(QWidgetOrQuick *);
     void releaseMouse(QWidgetOrQuick *);
 
+    ///@brief returns how many times a drop area computed hovering, since startup. For profiling.
+    qint64 hoverCount() const;
+
 Q_SIGNALS:
     void mousePressed();
     void manhattanLengthMove();
@@ -80,6 +83,7 @@ private:
     DropArea *m_currentDropArea = nullptr;
     bool m_nonClientDrag = false;
     FallbackMouseGrabber *m_fallbackMouseGrabber = nullptr;
+    qint64 m_numHovers = 0;
 };
 
 class StateBase : public QState
@@ -266,6 +266,7 @@ bool DropArea::drop(QWidgetOrQuick *droppedWindow, KDDockWidgets::Location locat
 
 void DropArea::removeHover()
 {
+    clearDropRectCache();
     m_dropIndicatorOverlay->setWindowBeingDragged(nullptr);
     m_dropIndicatorOverlay->setCurrentDropLocation(DropIndicatorOverlayInterface::DropLocation_None);
 }
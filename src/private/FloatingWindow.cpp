@@ -21,9 +21,11 @@
 #include "DockRegistry_p.h"
 #include "Config.h"
 #include "FrameworkWidgetFactory.h"
+#include "FloatingWindowPool_p.h"
 
 #include <QCloseEvent>
 #include <QAbstractNativeEventFilter>
+#include <QTimer>
 #include <QWindow>
 
 #if defined(Q_OS_WIN) && defined(KDDOCKWIDGETS_QTWIDGETS)
@@ -293,12 +295,66 @@ void FloatingWindow::onFrameCountChanged(int count)
 {
     qCDebug(docking) << "FloatingWindow::onFrameCountChanged" << count;
     if (count == 0) {
-        scheduleDeleteLater();
+        recycleOrDeleteLater();
     } else {
         updateTitleBarVisibility();
     }
 }
 
+void FloatingWindow::recycleOrDeleteLater()
+{
+    if (Config::self().floatingWindowPoolSize() == 0) {
+        scheduleDeleteLater();
+        return;
+    }
+
+    // Defer, as we might be inside a drop which is about to delete our DropArea, in which case
+    // scheduleDeleteLater() is called and there's nothing to recycle.
+    QTimer::singleShot(0, this, [this] {
+        if (m_deleteScheduled || !frames().isEmpty())
+            return;
+
+        if (!FloatingWindowPool::self()->recycle(this))
+            scheduleDeleteLater();
+    });
+}
+
+void FloatingWindow::prepareForPool()
+{
+    hide();
+
+    // Placeholders of closed dock widgets die with the window, same as if it had been deleted
+    m_dropArea->clearLayout();
+    DockRegistry::self()->unregisterNestedWindow(this);
+}
+
+bool FloatingWindow::canBeReusedFor(Frame *frame, MainWindowBase *parent) const
+{
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+    // The window type depends on Config flags, which might have changed meanwhile
+    const Qt::WindowType type = KDDockWidgets::usesNativeDraggingAndResizing() ? Qt::Window : Qt::Tool;
+    if (windowType() != type)
+        return false;
+#endif
+
+    // Changing the parent of a top-level can recreate its native window, which is what we're avoiding
+    return parentWidget() == hackFindParentHarder(frame, parent);
+}
+
+void FloatingWindow::prepareForReuse(Frame *frame)
+{
+    DockRegistry::self()->registerNestedWindow(this);
+
+    if (frame) {
+        // Like in the ctor, don't show the window while adding the frame
+        m_disableSetVisible = true;
+        m_dropArea->addWidget(frame, KDDockWidgets::Location_OnTop, {});
+        m_disableSetVisible = false;
+    }
+
+    updateTitleBarVisibility();
+}
+
 void FloatingWindow::onVisibleFrameCountChanged(int count)
 {
     if (!m_disableSetVisible) {
@@ -379,7 +435,12 @@ bool FloatingWindow::deserialize(const LayoutSaver::FloatingWindow &fw)
 {
     if (dropArea()->deserialize(fw.multiSplitterLayout)) {
         updateTitleBarVisibility();
-        show();
+        if (fw.isVisible) {
+            show();
+        } else {
+            // Don't show it just to hide it, so no native window is created until it's needed
+            hide();
+        }
         return true;
     } else {
         return false;
@@ -0,0 +1,113 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "FloatingWindowPool_p.h"
+#include "FloatingWindow_p.h"
+#include "Config.h"
+#include "Logging_p.h"
+
+#include <QCoreApplication>
+
+using namespace KDDockWidgets;
+
+FloatingWindowPool::FloatingWindowPool(QObject *parent)
+    : QObject(parent)
+{
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, &FloatingWindowPool::clear);
+
+    // Don't keep windows alive past the event loop
+    if (qApp)
+        connect(qApp, &QCoreApplication::aboutToQuit, this, &FloatingWindowPool::clear);
+}
+
+FloatingWindowPool::~FloatingWindowPool()
+{
+    clear();
+}
+
+FloatingWindowPool *FloatingWindowPool::self()
+{
+    static QPointer<FloatingWindowPool> s_floatingWindowPool;
+
+    if (!s_floatingWindowPool)
+        s_floatingWindowPool = new FloatingWindowPool(qApp);
+
+    return s_floatingWindowPool;
+}
+
+bool FloatingWindowPool::recycle(FloatingWindow *floatingWindow)
+{
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+    if (!floatingWindow || !floatingWindow->frames().isEmpty())
+        return false;
+
+    m_floatingWindows.removeAll(nullptr); // Deleted along with their main window
+    if (m_floatingWindows.size() >= Config::self().floatingWindowPoolSize())
+        return false;
+
+    floatingWindow->prepareForPool();
+    m_floatingWindows.push_back(floatingWindow);
+    qCDebug(creation) << Q_FUNC_INFO << floatingWindow << "; pool size=" << m_floatingWindows.size();
+
+    restartIdleTimer();
+    return true;
+#else
+    // QtQuick floating windows hold a separate QQuickView, which they delete when hidden
+    Q_UNUSED(floatingWindow);
+    return false;
+#endif
+}
+
+FloatingWindow *FloatingWindowPool::take(Frame *frame, MainWindowBase *parent)
+{
+    for (int i = 0; i < m_floatingWindows.size(); ++i) {
+        FloatingWindow *floatingWindow = m_floatingWindows.at(i);
+        if (floatingWindow && floatingWindow->canBeReusedFor(frame, parent)) {
+            m_floatingWindows.removeAt(i);
+            floatingWindow->prepareForReuse(frame);
+            qCDebug(creation) << Q_FUNC_INFO << floatingWindow << "; pool size=" << m_floatingWindows.size();
+            restartIdleTimer();
+            return floatingWindow;
+        }
+    }
+
+    return nullptr;
+}
+
+void FloatingWindowPool::clear()
+{
+    m_idleTimer.stop();
+    const QVector<QPointer<FloatingWindow>> floatingWindows = m_floatingWindows;
+    m_floatingWindows.clear();
+    for (FloatingWindow *floatingWindow : floatingWindows)
+        delete floatingWindow;
+}
+
+int FloatingWindowPool::count() const
+{
+    int result = 0;
+    for (FloatingWindow *floatingWindow : m_floatingWindows) {
+        if (floatingWindow)
+            result++;
+    }
+
+    return result;
+}
+
+void FloatingWindowPool::restartIdleTimer()
+{
+    const int timeout = Config::self().framePoolIdleTimeout();
+    if (timeout > 0 && count() > 0)
+        m_idleTimer.start(timeout);
+    else
+        m_idleTimer.stop();
+}
@@ -0,0 +1,67 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#ifndef KD_FLOATINGWINDOWPOOL_P_H
+#define KD_FLOATINGWINDOWPOOL_P_H
+
+#include "docks_export.h"
+
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+
+/**
+ * FloatingWindowPool keeps hidden, empty FloatingWindows around so they can be reused instead of
+ * being deleted and recreated. A hidden top-level keeps its native window, so detaching a tab or
+ * floating a dock widget doesn't pay for a new platform window each time.
+ *
+ * It's opt-in, see Config::setFloatingWindowPoolSize(). QtWidgets only.
+ * It's a private implementation detail.
+ */
+namespace KDDockWidgets
+{
+
+class FloatingWindow;
+class Frame;
+class MainWindowBase;
+
+class DOCKS_EXPORT_FOR_UNIT_TESTS FloatingWindowPool : public QObject
+{
+    Q_OBJECT
+public:
+    static FloatingWindowPool *self();
+    ~FloatingWindowPool() override;
+
+    ///@brief Keeps the empty @p floatingWindow for reuse.
+    ///Returns false if the pool is disabled or full, in which case the caller should delete the window.
+    bool recycle(FloatingWindow *floatingWindow);
+
+    ///@brief Returns a pooled floating window, with @p frame added to it, if not null.
+    ///Returns nullptr if there's none available for the same parent.
+    FloatingWindow *take(Frame *frame, MainWindowBase *parent);
+
+    ///@brief Deletes all pooled floating windows
+    void clear();
+
+    ///@brief returns the number of pooled floating windows
+    int count() const;
+
+private:
+    explicit FloatingWindowPool(QObject *parent = nullptr);
+    void restartIdleTimer();
+    QVector<QPointer<FloatingWindow>> m_floatingWindows; // QPointer, as they're children of the main window
+    QTimer m_idleTimer;
+};
+
+}
+
+#endif
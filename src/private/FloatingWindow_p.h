@@ -139,8 +139,22 @@ protected:
     TitleBar *const m_titleBar;
 private:
     Q_DISABLE_COPY(FloatingWindow)
+    friend class FloatingWindowPool;
     void maybeCreateResizeHandler();
     void onFrameCountChanged(int count);
+
+    ///@brief Called when the last frame is removed. Either recycles this window or deletes it
+    void recycleOrDeleteLater();
+
+    ///@brief Clears the layout and unregisters this window, so it can sit in the FloatingWindowPool
+    void prepareForPool();
+
+    ///@brief returns whether this pooled window can host @p frame, it must have the same parent
+    bool canBeReusedFor(Frame *frame, MainWindowBase *parent) const;
+
+    ///@brief Counter-part of prepareForPool(), called when the pool hands this window out again
+    void prepareForReuse(Frame *frame);
+
     void onVisibleFrameCountChanged(int count);
     bool m_disableSetVisible = false;
     bool m_deleteScheduled = false;
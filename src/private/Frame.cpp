@@ -26,6 +26,7 @@
 #include "Config.h"
 #include "TitleBar_p.h"
 #include "FrameworkWidgetFactory.h"
+#include "FramePool_p.h"
 
 #include <QCloseEvent>
 #include <QTimer>
@@ -36,16 +37,6 @@ static int s_dbg_numFrames = 0;
 
 using namespace KDDockWidgets;
 
-namespace KDDockWidgets {
-static FrameOptions actualOptions(FrameOptions options)
-{
-    if (Config::self().flags() & Config::Flag_AlwaysShowTabs)
-        options |= FrameOption_AlwaysShowsTabs;
-
-    return options;
-}
-}
-
 Frame::Frame(QWidgetOrQuick *parent, FrameOptions options)
     : LayoutGuestWidget(parent)
     , FocusScope(this)
@@ -63,12 +54,15 @@ Frame::Frame(QWidgetOrQuick *parent, FrameOptions options)
 Frame::~Frame()
 {
     m_inDtor = true;
-    s_dbg_numFrames--;
     if (m_layoutItem)
         m_layoutItem->unref();
 
     qCDebug(creation) << "~Frame" << static_cast<void*>(this);
-    DockRegistry::self()->unregisterFrame(this);
+    if (!m_isPooled) {
+        // Pooled frames were already unregistered
+        s_dbg_numFrames--;
+        DockRegistry::self()->unregisterFrame(this);
+    }
 
     // Run some disconnects() too, so we don't receive signals during destruction:
     setDropArea(nullptr);
@@ -226,6 +220,7 @@ int Frame::dockWidgetCount() const
 void Frame::onDockWidgetCountChanged()
 {
     qCDebug(docking) << "Frame::onDockWidgetCountChanged:" << this << "; widgetCount=" << dockWidgetCount();
+    invalidateSizeConstraints();
     if (isEmpty() && !isCentralFrame()) {
         scheduleDeleteLater();
     } else {
@@ -597,27 +592,78 @@ LayoutSaver::Frame Frame::serialize() const
     return frame;
 }
 
+FrameOptions Frame::actualOptions(FrameOptions options)
+{
+    if (Config::self().flags() & Config::Flag_AlwaysShowTabs)
+        options |= FrameOption_AlwaysShowsTabs;
+
+    return options;
+}
+
 void Frame::scheduleDeleteLater()
 {
     qCDebug(creation) << Q_FUNC_INFO << this;
     m_beingDeleted = true;
     QTimer::singleShot(0, this, [this] {
+        // Give the frame a chance to be reused, see Config::setFramePoolSize()
+        if (FramePool::self()->recycle(this))
+            return;
+
         // Can't use deleteLater() here due to QTBUG-83030 (deleteLater() never delivered if triggered by a sendEvent() before event loop starts)
         delete this;
     });
 }
 
+void Frame::prepareForPool()
+{
+    Q_ASSERT(isEmpty());
+
+    // Same as what the layout sees when a Frame is deleted: the item turns into a placeholder
+    // when the frame is reparented and is removed once nobody references it anymore.
+    // Reparenting also hides it, without marking it explicitly hidden.
+    QWidgetAdapter::setParent(nullptr);
+    setLayoutItem(nullptr);
+
+    setObjectName(QString());
+    m_titleBar->setTitle(QString());
+    m_titleBar->setIcon(QIcon());
+
+    m_isPooled = true;
+    s_dbg_numFrames--;
+    DockRegistry::self()->unregisterFrame(this);
+}
+
+void Frame::prepareForReuse(QWidgetOrQuick *parent)
+{
+    Q_ASSERT(m_isPooled);
+    m_isPooled = false;
+    m_beingDeleted = false;
+    s_dbg_numFrames++;
+    DockRegistry::self()->registerFrame(this);
+
+    QWidgetAdapter::setParent(parent);
+}
+
 QSize Frame::dockWidgetsMinSize() const
 {
+    if (m_cachedDockWidgetsMinSize.isValid())
+        return m_cachedDockWidgetsMinSize;
+
+    countSizeConstraintsComputation();
     QSize size = Layouting::Item::hardcodedMinimumSize;
     for (DockWidgetBase *dw : dockWidgets())
         size = size.expandedTo(Layouting::Widget_qwidget::widgetMinSize(dw));
 
+    m_cachedDockWidgetsMinSize = size;
     return size;
 }
 
 QSize Frame::biggestDockWidgetMaxSize() const
 {
+    if (m_cachedBiggestDockWidgetMaxSize.isValid())
+        return m_cachedBiggestDockWidgetMaxSize;
+
+    countSizeConstraintsComputation();
     QSize size = Layouting::Item::hardcodedMaximumSize;
     for (DockWidgetBase *dw : dockWidgets()) {
         const QSize dwMax = widgetMaxSize(dw);
@@ -637,9 +683,17 @@ QSize Frame::biggestDockWidgetMaxSize() const
     if (size.height() == 0)
         size.setHeight(Layouting::Item::hardcodedMaximumSize.height());
 
+    m_cachedBiggestDockWidgetMaxSize = size;
     return size;
 }
 
+void Frame::invalidateSizeConstraints()
+{
+    LayoutGuestWidgetBase::invalidateSizeConstraints();
+    m_cachedDockWidgetsMinSize = QSize();
+    m_cachedBiggestDockWidgetMaxSize = QSize();
+}
+
 QRect Frame::dragRect() const
 {
     QRect rect;
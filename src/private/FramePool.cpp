@@ -0,0 +1,101 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "FramePool_p.h"
+#include "Frame_p.h"
+#include "Config.h"
+#include "Logging_p.h"
+
+#include <QCoreApplication>
+#include <QPointer>
+
+using namespace KDDockWidgets;
+
+FramePool::FramePool(QObject *parent)
+    : QObject(parent)
+{
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, &FramePool::clear);
+
+    // Don't keep widgets alive past the event loop
+    if (qApp)
+        connect(qApp, &QCoreApplication::aboutToQuit, this, &FramePool::clear);
+}
+
+FramePool::~FramePool()
+{
+    clear();
+}
+
+FramePool *FramePool::self()
+{
+    static QPointer<FramePool> s_framePool;
+
+    if (!s_framePool)
+        s_framePool = new FramePool(qApp);
+
+    return s_framePool;
+}
+
+bool FramePool::recycle(Frame *frame)
+{
+    if (!frame || !frame->isEmpty() || frame->isCentralFrame())
+        return false;
+
+    if (m_frames.size() >= Config::self().framePoolSize())
+        return false;
+
+    frame->prepareForPool();
+    m_frames.push_back(frame);
+    qCDebug(creation) << Q_FUNC_INFO << frame << "; pool size=" << m_frames.size();
+
+    restartIdleTimer();
+    return true;
+}
+
+Frame *FramePool::take(QWidgetOrQuick *parent, FrameOptions options)
+{
+    const FrameOptions wantedOptions = Frame::actualOptions(options);
+    for (int i = 0, end = m_frames.size(); i < end; ++i) {
+        Frame *frame = m_frames.at(i);
+        if (frame->options() == wantedOptions) {
+            m_frames.removeAt(i);
+            frame->prepareForReuse(parent);
+            qCDebug(creation) << Q_FUNC_INFO << frame << "; pool size=" << m_frames.size();
+            restartIdleTimer();
+            return frame;
+        }
+    }
+
+    return nullptr;
+}
+
+void FramePool::clear()
+{
+    m_idleTimer.stop();
+    const QVector<Frame*> frames = m_frames;
+    m_frames.clear();
+    qDeleteAll(frames);
+}
+
+int FramePool::count() const
+{
+    return m_frames.size();
+}
+
+void FramePool::restartIdleTimer()
+{
+    const int timeout = Config::self().framePoolIdleTimeout();
+    if (timeout > 0 && !m_frames.isEmpty())
+        m_idleTimer.start(timeout);
+    else
+        m_idleTimer.stop();
+}
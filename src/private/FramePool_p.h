@@ -0,0 +1,66 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#ifndef KD_FRAMEPOOL_P_H
+#define KD_FRAMEPOOL_P_H
+
+#include "docks_export.h"
+#include "KDDockWidgets.h"
+#include "QWidgetAdapter.h"
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+
+/**
+ * FramePool keeps empty Frames around so they can be reused instead of being deleted and recreated.
+ * Recycling a Frame also recycles its TitleBar, TabWidget and TabBar, which saves construction,
+ * style polish and layouting when docking, undocking and restoring.
+ *
+ * It's opt-in, see Config::setFramePoolSize().
+ * It's a private implementation detail.
+ */
+namespace KDDockWidgets
+{
+
+class Frame;
+
+class DOCKS_EXPORT_FOR_UNIT_TESTS FramePool : public QObject
+{
+    Q_OBJECT
+public:
+    static FramePool *self();
+    ~FramePool() override;
+
+    ///@brief Takes ownership of the empty @p frame, resets it and keeps it for reuse.
+    ///Returns false if the pool is disabled or full, in which case the caller should delete the frame.
+    bool recycle(Frame *frame);
+
+    ///@brief Returns a pooled frame with the specified options, reparented into @p parent.
+    ///Returns nullptr if there's none available.
+    Frame *take(QWidgetOrQuick *parent, FrameOptions options);
+
+    ///@brief Deletes all pooled frames
+    void clear();
+
+    ///@brief returns the number of pooled frames
+    int count() const;
+
+private:
+    explicit FramePool(QObject *parent = nullptr);
+    void restartIdleTimer();
+    QVector<Frame*> m_frames;
+    QTimer m_idleTimer;
+};
+
+}
+
+#endif
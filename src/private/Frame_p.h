@@ -220,6 +220,9 @@ public:
      */
     virtual QRect dragRect() const;
 
+    ///@brief Also drops the cached dockWidgetsMinSize() and biggestDockWidgetMaxSize()
+    void invalidateSizeConstraints() override;
+
 Q_SIGNALS:
     void currentDockWidgetChanged(KDDockWidgets::DockWidgetBase *);
     void numDockWidgetsChanged();
@@ -266,8 +269,16 @@ private:
     Q_DISABLE_COPY(Frame)
     friend class TestDocks;
     friend class TabWidget;
+    friend class FramePool;
+    static FrameOptions actualOptions(FrameOptions);
     void onCurrentTabChanged(int index);
     void scheduleDeleteLater();
+
+    ///@brief Detaches this empty frame from its layout and hides it, so it can sit in the FramePool
+    void prepareForPool();
+
+    ///@brief Counter-part of prepareForPool(), called when the FramePool hands this frame out again
+    void prepareForReuse(QWidgetOrQuick *parent);
     bool event(QEvent *) override;
     bool m_inCtor = true;
     TitleBar *const m_titleBar;
@@ -276,6 +287,9 @@ private:
     QPointer<Layouting::Item> m_layoutItem;
     bool m_updatingTitleBar = false;
     bool m_beingDeleted = false;
+    bool m_isPooled = false;
+    mutable QSize m_cachedDockWidgetsMinSize;
+    mutable QSize m_cachedBiggestDockWidgetMaxSize;
     QMetaObject::Connection m_visibleWidgetCountChangedConnection;
 };
 
@@ -33,6 +33,7 @@
 #include "DropArea_p.h"
 
 #include <QScopedValueRollback>
+#include <QTimer>
 
 using namespace KDDockWidgets;
 
@@ -75,12 +76,43 @@ bool MultiSplitter::onResize(QSize newSize)
 
     if (!LayoutSaver::restoreInProgress()) {
         // don't resize anything while we're restoring the layout
-        setLayoutSize(newSize);
+        if ((Config::self().flags() & Config::Flag_LazyWindowResize) && isVisible()) {
+            // Relayout at most once per interval, with whatever size the window has by then
+            if (!m_lazyResizeTimer) {
+                m_lazyResizeTimer = new QTimer(this);
+                m_lazyResizeTimer->setSingleShot(true);
+                connect(m_lazyResizeTimer, &QTimer::timeout, this, &MultiSplitter::applyPendingResize);
+            }
+
+            if (!m_lazyResizeTimer->isActive())
+                m_lazyResizeTimer->start(Config::self().lazyWindowResizeInterval());
+        } else {
+            setLayoutSize(newSize);
+        }
     }
 
     return false; // So QWidget::resizeEvent is called
 }
 
+void MultiSplitter::applyPendingResize()
+{
+    if (!m_lazyResizeTimer)
+        return;
+
+    m_lazyResizeTimer->stop();
+    if (LayoutSaver::restoreInProgress())
+        return;
+
+    // The window already has its size, only the layout needs to catch up
+    QScopedValueRollback<bool> guard(m_inResizeEvent, true);
+    setLayoutSize(QWidgetAdapter::size());
+}
+
+bool MultiSplitter::hasPendingResize() const
+{
+    return m_lazyResizeTimer && m_lazyResizeTimer->isActive();
+}
+
 bool MultiSplitter::isInMainWindow() const
 {
     return mainWindow() != nullptr;
@@ -168,6 +200,8 @@ void MultiSplitter::addWidget(QWidgetOrQuick *w, Location location,
                        << "; frame=" << frame
                        << "; option=" << option;
 
+    applyPendingResize();
+
     if (itemForFrame(frame) != nullptr) {
         // Item already exists, remove it.
         // Changing the frame parent will make the item clean itself up. It turns into a placeholder and is removed by unrefOldPlaceholders
@@ -225,6 +259,8 @@ void MultiSplitter::removeItem(Layouting::Item *item)
         return;
     }
 
+    applyPendingResize();
+
     item->parentContainer()->removeItem(item);
 }
 
@@ -316,6 +352,8 @@ Frame::List MultiSplitter::frames() const
 
 void MultiSplitter::restorePlaceholder(DockWidgetBase *dw, Layouting::Item *item, int tabIndex)
 {
+    applyPendingResize();
+
     if (item->isPlaceholder()) {
         Frame *newFrame = Config::self().frameworkWidgetFactory()->createFrame(this);
         item->restore(newFrame);
@@ -340,6 +378,7 @@ void MultiSplitter::layoutEqually()
 
 void MultiSplitter::layoutEqually(Layouting::ItemContainer *container)
 {
+    applyPendingResize();
     if (container) {
         container->layoutEqually_recursive();
     } else {
@@ -401,6 +440,18 @@ void MultiSplitter::setRootItem(Layouting::ItemContainer *root)
     connect(m_rootItem, &Layouting::ItemContainer::minSizeChanged, this, [this] {
         setMinimumSize(layoutMinimumSize());
     });
+
+    // Any change to the layout makes the suggested drop rects stale
+    connect(m_rootItem, &Layouting::ItemContainer::numItemsChanged,
+            this, &MultiSplitter::clearDropRectCache);
+    connect(m_rootItem, &Layouting::ItemContainer::numVisibleItemsChanged,
+            this, &MultiSplitter::clearDropRectCache);
+    connect(m_rootItem, &Layouting::ItemContainer::geometryChanged,
+            this, &MultiSplitter::clearDropRectCache);
+    connect(m_rootItem, &Layouting::ItemContainer::minSizeChanged,
+            this, &MultiSplitter::clearDropRectCache);
+
+    clearDropRectCache();
 }
 
 const Layouting::Item::List MultiSplitter::items() const
@@ -421,14 +472,56 @@ QRect MultiSplitter::rectForDrop(const FloatingWindow *fw, Location location,
         return {};
 
     Layouting::ItemContainer *root = fw->dropArea()->rootItem();
-    item.setSize(root->size());
-    item.setMinSize(root->minSize());
-    item.setMaxSizeHint(root->maxSizeHint());
+    const QSize size = root->size();
+    const QSize minSize = root->minSize();
+    const QSize maxSizeHint = root->maxSizeHint();
+
+    // suggestedDropRect() is expensive, as it simulates the drop on a copy of the layout.
+    // While dragging, the same few rects are requested over and over, so cache them.
+    for (const DropRectCacheEntry &entry : qAsConst(m_dropRectCache)) {
+        if (entry.relativeTo == relativeTo && entry.location == location && entry.size == size
+                && entry.minSize == minSize && entry.maxSizeHint == maxSizeHint) {
+            m_dropRectCacheHits++;
+            return entry.rect;
+        }
+    }
+
+    m_dropRectCacheMisses++;
+
+    item.setSize(size);
+    item.setMinSize(minSize);
+    item.setMaxSizeHint(maxSizeHint);
 
     Layouting::ItemContainer *container = relativeTo ? relativeTo->parentContainer()
                                                      : m_rootItem;
 
-    return container->suggestedDropRect(&item, relativeTo, Layouting::Item::Location(location));
+    const QRect rect = container->suggestedDropRect(&item, relativeTo, Layouting::Item::Location(location));
+    m_dropRectCache.push_back({ relativeTo, location, size, minSize, maxSizeHint, rect });
+
+    return rect;
+}
+
+void MultiSplitter::clearDropRectCache()
+{
+    m_dropRectCache.clear();
+}
+
+int MultiSplitter::dropRectCacheHits() const
+{
+    return m_dropRectCacheHits;
+}
+
+int MultiSplitter::dropRectCacheMisses() const
+{
+    return m_dropRectCacheMisses;
+}
+
+void MultiSplitter::clearLayout()
+{
+    Q_ASSERT(visibleCount() == 0);
+    setRootItem(new Layouting::ItemContainer(this));
+    m_rootItem->setSize_recursive(QWidgetAdapter::size());
+    updateSizeConstraints();
 }
 
 bool MultiSplitter::deserialize(const LayoutSaver::MultiSplitter &l)
@@ -29,6 +29,10 @@
 #include "LayoutSaver_p.h"
 
 
+QT_BEGIN_NAMESPACE
+class QTimer;
+QT_END_NAMESPACE
+
 namespace Layouting {
 class Item;
 class Separator;
@@ -134,6 +138,24 @@ public:
     QRect rectForDrop(const FloatingWindow *, KDDockWidgets::Location location,
                       const Layouting::Item *relativeTo) const;
 
+    /**
+     * @brief Discards the rects cached by @ref rectForDrop.
+     * Called when a drag leaves this layout and whenever the layout changes.
+     */
+    void clearDropRectCache();
+
+    ///@brief returns how many @ref rectForDrop calls were served from the cache. For tests and profiling.
+    int dropRectCacheHits() const;
+
+    ///@brief returns how many @ref rectForDrop calls had to compute the rect. For tests and profiling.
+    int dropRectCacheMisses() const;
+
+    /**
+     * @brief Removes all items from this layout, including placeholders.
+     * The layout shouldn't have any visible frame at this point.
+     */
+    void clearLayout();
+
     bool deserialize(const LayoutSaver::MultiSplitter &);
     LayoutSaver::MultiSplitter serialize() const;
 
@@ -153,6 +175,15 @@ public:
      */
     void setLayoutSize(QSize);
 
+    /**
+     * @brief Applies the window size that Config::Flag_LazyWindowResize deferred, if any.
+     * Called before any operation that needs the layout to match the window size.
+     */
+    void applyPendingResize();
+
+    ///@brief Returns whether a window resize is waiting to be applied to the layout
+    bool hasPendingResize() const;
+
     /**
      * @brief returns the contents width.
      * Usually it's the same width as the respective parent MultiSplitter.
@@ -256,6 +287,24 @@ private:
     QSize availableSize() const;
 
     Layouting::ItemContainer *m_rootItem = nullptr;
+
+    ///@brief Throttles relayouting while resizing the window, see Config::Flag_LazyWindowResize
+    QTimer *m_lazyResizeTimer = nullptr;
+
+    ///@brief An entry of the rectForDrop() cache. The dragged window is identified by its sizes.
+    struct DropRectCacheEntry {
+        const Layouting::Item *relativeTo;
+        KDDockWidgets::Location location;
+        QSize size;
+        QSize minSize;
+        QSize maxSizeHint;
+        QRect rect;
+    };
+
+    // Only a handful of entries per drag (one per indicator per hovered frame), so a vector is fine
+    mutable QVector<DropRectCacheEntry> m_dropRectCache;
+    mutable int m_dropRectCacheHits = 0;
+    mutable int m_dropRectCacheMisses = 0;
 };
 
 }
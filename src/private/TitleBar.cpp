@@ -154,7 +154,8 @@ std::unique_ptr<WindowBeingDragged> TitleBar::makeWindow()
 
     auto floatingWindow = Config::self().frameworkWidgetFactory()->createFloatingWindow(m_frame);
     floatingWindow->setSuggestedGeometry(r);
-    floatingWindow->show();
+    if (!KDDockWidgets::usesOutlineDragging()) // Otherwise only shown if it's not dropped
+        floatingWindow->show();
     qCDebug(hovering) << "TitleBar::makeWindow setting geometry" << r << "actual=" << floatingWindow->geometry();
 
     auto draggable = KDDockWidgets::usesNativeTitleBar() ? static_cast<Draggable*>(floatingWindow)
@@ -284,7 +285,11 @@ void TitleBar::onFloatClicked()
             // is that it has logic for using the last used geometry for the floating window
             dockWidgets[0]->setFloating(true);
         } else {
-            makeWindow();
+            // Not a drag, so show it right away, which Flag_OutlineDragging would defer
+            if (std::unique_ptr<WindowBeingDragged> windowBeingDragged = makeWindow()) {
+                if (FloatingWindow *fw = windowBeingDragged->floatingWindow())
+                    fw->show();
+            }
         }
     }
 }
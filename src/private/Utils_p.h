@@ -53,6 +53,16 @@ inline bool usesNativeDraggingAndResizing()
     return usesNativeTitleBar() || usesAeroSnapWithCustomDecos();
 }
 
+inline bool usesLazyResize()
+{
+    return Config::self().flags() & Config::Flag_LazyResize;
+}
+
+inline bool usesOutlineDragging()
+{
+    return Config::self().flags() & Config::Flag_OutlineDragging;
+}
+
 inline bool windowManagerHasTranslucency()
 {
 #ifdef QT_X11EXTRAS_LIB
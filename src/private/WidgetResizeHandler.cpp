@@ -15,6 +15,7 @@
 #include "DragController_p.h"
 #include "Config.h"
 #include "Qt5Qt6Compat_p.h"
+#include "Utils_p.h"
 
 #include <QEvent>
 #include <QMouseEvent>
@@ -24,6 +25,7 @@
 #include <QScreen>
 #include <QWindow>
 #include <QAbstractButton>
+#include <QRubberBand>
 
 #if defined(Q_OS_WIN)
 # include <Windowsx.h>
@@ -87,6 +89,7 @@ bool WidgetResizeHandler::eventFilter(QObject *o, QEvent *e)
         auto mouseEvent = static_cast<QMouseEvent *>(e);
         if (mouseEvent->button() == Qt::LeftButton) {
             mResizeWidget = false;
+            applyOutlineGeometry();
             mTarget->releaseMouse();
             mTarget->releaseKeyboard();
             return true;
@@ -98,12 +101,18 @@ bool WidgetResizeHandler::eventFilter(QObject *o, QEvent *e)
             break;
         auto mouseEvent = static_cast<QMouseEvent *>(e);
         mResizeWidget = mResizeWidget && (mouseEvent->buttons() & Qt::LeftButton);
+        if (!mResizeWidget)
+            applyOutlineGeometry(); // In case we missed the release
         const bool state = mResizeWidget;
         mResizeWidget = ((o == mTarget) && mResizeWidget);
         mouseMoveEvent(mouseEvent);
         mResizeWidget = state;
         return true;
     }
+    case QEvent::Leave:
+        // Whatever changes the cursor while outside, updateCursor() must apply it again when back
+        mCursorShapePos = CursorPosition::Undefined;
+        break;
     default:
         break;
     }
@@ -118,7 +127,16 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         return;
     }
 
-    const QRect oldGeometry = mTarget->geometry();
+    // With lazy resize only the outline is resized while dragging, which doesn't relayout anything
+    const bool lazy = usesLazyResize();
+    if (lazy && !mOutline) {
+        mOutline = new QRubberBand(QRubberBand::Rectangle);
+        mOutline->setObjectName(QStringLiteral("_docks_ResizeOutline"));
+        mOutline->setGeometry(mTarget->geometry());
+        mOutline->show();
+    }
+
+    const QRect oldGeometry = lazy ? mOutline->geometry() : mTarget->geometry();
     QRect newGeometry = oldGeometry;
 
     {
@@ -131,8 +149,8 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         case CursorPosition::Left:
         case CursorPosition::BottomLeft: {
             deltaWidth = oldGeometry.left() - globalPos.x();
-            newWidth = qBound(minWidth, mTarget->width() + deltaWidth, maxWidth);
-            deltaWidth = newWidth - mTarget->width();
+            newWidth = qBound(minWidth, oldGeometry.width() + deltaWidth, maxWidth);
+            deltaWidth = newWidth - oldGeometry.width();
             if (deltaWidth != 0) {
                 newGeometry.setLeft(newGeometry.left() - deltaWidth);
             }
@@ -144,8 +162,8 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         case CursorPosition::Right:
         case CursorPosition::BottomRight: {
             deltaWidth = globalPos.x() - newGeometry.right();
-            newWidth = qBound(minWidth, mTarget->width() + deltaWidth, maxWidth);
-            deltaWidth = newWidth - mTarget->width();
+            newWidth = qBound(minWidth, oldGeometry.width() + deltaWidth, maxWidth);
+            deltaWidth = newWidth - oldGeometry.width();
             if (deltaWidth != 0) {
                 newGeometry.setRight(oldGeometry.right() + deltaWidth);
             }
@@ -166,8 +184,8 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         case CursorPosition::Top:
         case CursorPosition::TopRight: {
             deltaHeight = oldGeometry.top() - globalPos.y();
-            newHeight = qBound(minHeight, mTarget->height() + deltaHeight, maxHeight);
-            deltaHeight = newHeight - mTarget->height();
+            newHeight = qBound(minHeight, oldGeometry.height() + deltaHeight, maxHeight);
+            deltaHeight = newHeight - oldGeometry.height();
             if (deltaHeight != 0) {
                 newGeometry.setTop(newGeometry.top() - deltaHeight);
             }
@@ -179,8 +197,8 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         case CursorPosition::Bottom:
         case CursorPosition::BottomRight: {
             deltaHeight = globalPos.y() - newGeometry.bottom();
-            newHeight = qBound(minHeight, mTarget->height() + deltaHeight, maxHeight);
-            deltaHeight = newHeight - mTarget->height();
+            newHeight = qBound(minHeight, oldGeometry.height() + deltaHeight, maxHeight);
+            deltaHeight = newHeight - oldGeometry.height();
             if (deltaHeight != 0) {
                 newGeometry.setBottom(oldGeometry.bottom() + deltaHeight);
             }
@@ -191,10 +209,26 @@ void WidgetResizeHandler::mouseMoveEvent(QMouseEvent *e)
         }
     }
 
-    if (newGeometry != mTarget->geometry())
+    if (newGeometry == oldGeometry)
+        return;
+
+    if (lazy)
+        mOutline->setGeometry(newGeometry);
+    else
         mTarget->setGeometry(newGeometry);
 }
 
+void WidgetResizeHandler::applyOutlineGeometry()
+{
+    if (!mOutline)
+        return;
+
+    const QRect geometry = mOutline->geometry();
+    delete mOutline;
+    if (geometry != mTarget->geometry())
+        mTarget->setGeometry(geometry);
+}
+
 
 #ifdef Q_OS_WIN
 
@@ -311,6 +345,7 @@ void WidgetResizeHandler::setTarget(QWidget *w)
 {
     if (w) {
         mTarget = w;
+        mCursorShapePos = CursorPosition::Undefined; // The new target's cursor wasn't set by us
         mTarget->setMouseTracking(true);
         mTarget->installEventFilter(this);
     } else {
@@ -320,6 +355,11 @@ void WidgetResizeHandler::setTarget(QWidget *w)
 
 void WidgetResizeHandler::updateCursor(CursorPosition m)
 {
+    // Mouse moves are frequent, only touch the cursors when the hovered edge changes
+    if (m == mCursorShapePos)
+        return;
+    mCursorShapePos = m;
+
     //Need for updating cursor when we change child widget
     const QObjectList children = mTarget->children();
     for (int i = 0, total = children.size(); i < total; ++i) {
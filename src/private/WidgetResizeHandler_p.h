@@ -14,10 +14,12 @@
 
 #include <QWidget>
 #include <QPoint>
+#include <QPointer>
 #include <QDebug>
 
 QT_BEGIN_NAMESPACE
 class QMouseEvent;
+class QRubberBand;
 QT_END_NAMESPACE
 
 namespace KDDockWidgets {
@@ -55,8 +57,14 @@ private:
     void mouseMoveEvent(QMouseEvent *e);
     void updateCursor(CursorPosition m);
     CursorPosition cursorPosition(QPoint) const;
+
+    ///@brief With Config::Flag_LazyResize, resizes the target to the outline and removes it
+    void applyOutlineGeometry();
+
     QWidget *mTarget = nullptr;
     CursorPosition mCursorPos = CursorPosition::Undefined;
+    CursorPosition mCursorShapePos = CursorPosition::Undefined; // What updateCursor() last applied
+    QPointer<QRubberBand> mOutline;
     QPoint mNewPosition;
     bool mResizeWidget = false;
 };
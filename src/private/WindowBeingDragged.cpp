@@ -14,6 +14,10 @@
 #include "Logging_p.h"
 #include "Utils_p.h"
 
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+# include <QRubberBand>
+#endif
+
 using namespace KDDockWidgets;
 
 static Draggable* bestDraggable(Draggable *draggable)
@@ -62,6 +66,11 @@ WindowBeingDragged::~WindowBeingDragged()
     const qreal opacity = Config::self().draggedWindowOpacity();
     if (!qIsNaN(opacity) && !qFuzzyCompare(1.0, opacity))
         m_floatingWindow->setWindowOpacity(1);
+
+    if (m_outline && m_floatingWindow && !m_floatingWindow->isVisible() && !m_floatingWindow->beingDeleted()) {
+        // The drag was interrupted before the deferred window was shown. Don't leave it hidden.
+        applyOutlineGeometry();
+    }
 }
 
 void WindowBeingDragged::init()
@@ -82,3 +91,43 @@ void WindowBeingDragged::grabMouse(bool grab)
     else
         DragController::instance()->releaseMouse(m_draggable);
 }
+
+void WindowBeingDragged::showOutline()
+{
+#ifdef KDDOCKWIDGETS_QTWIDGETS
+    if (m_outline || !m_floatingWindow)
+        return;
+
+    auto outline = new QRubberBand(QRubberBand::Rectangle);
+    outline->setObjectName(QStringLiteral("_docks_DragOutline"));
+    outline->setGeometry(m_floatingWindow->geometry());
+    outline->show();
+    m_outline.reset(outline);
+
+    if (!m_floatingWindow->isVisible()) {
+        // The window's creation was deferred, so its title bar can't grab the mouse.
+        // Grab with the outline instead and let the DragController see its events.
+        grabMouse(false);
+        m_outline->installEventFilter(DragController::instance());
+        m_draggable = m_outline.get();
+        grabMouse(true);
+    }
+#endif
+}
+
+void WindowBeingDragged::moveOutline(QPoint globalPos)
+{
+    if (m_outline)
+        m_outline->move(globalPos.x(), globalPos.y());
+}
+
+void WindowBeingDragged::applyOutlineGeometry()
+{
+    if (!m_outline || !m_floatingWindow)
+        return;
+
+    qCDebug(hovering) << "WindowBeingDragged::applyOutlineGeometry" << m_outline->geometry();
+    m_floatingWindow->setGeometry(m_outline->geometry());
+    if (!m_floatingWindow->isVisible())
+        m_floatingWindow->show();
+}
@@ -17,6 +17,8 @@
 
 #include <QPointer>
 
+#include <memory>
+
 namespace KDDockWidgets {
 
 class FloatingWindow;
@@ -34,10 +36,25 @@ public:
     ///@brief grabs or releases the mouse
     void grabMouse(bool grab);
 
+    ///@brief Shows a translucent outline with the window's geometry. The outline is moved instead
+    /// of the window. Only used with Config::Flag_OutlineDragging.
+    void showOutline();
+
+    ///@brief returns the outline that is being dragged instead of the window, if any
+    QWidgetOrQuick *outline() const { return m_outline.get(); }
+
+    ///@brief Moves the outline so its top-left corner is at @p globalPos
+    void moveOutline(QPoint globalPos);
+
+    ///@brief Moves the window to where the outline is, and shows it if it was still hidden
+    /// Called when the drag ended without the window being dropped.
+    void applyOutlineGeometry();
+
 private:
     Q_DISABLE_COPY(WindowBeingDragged)
     QPointer<FloatingWindow> m_floatingWindow;
     QPointer<QWidgetOrQuick> m_draggable;
+    std::unique_ptr<QWidgetOrQuick> m_outline;
 };
 }
 
@@ -123,8 +123,16 @@ KDDockWidgets::Location locationToMultisplitterLocation(ClassicIndicators::DropL
 
 void ClassicIndicators::setDropLocation(ClassicIndicators::DropLocation location)
 {
+    if (location != DropLocation_None && location == currentDropLocation()
+            && m_rubberBandFrameRect == hoveredFrameRect() && m_rubberBand->isVisible()) {
+        // Rubber band is already showing the right geometry, don't move and repaint it again.
+        // The QtQuick indicators call us on every mouse move.
+        return;
+    }
+
     qCDebug(overlay) << "ClassicIndicators::setCurrentDropLocation" << location;
     setCurrentDropLocation(location);
+    m_rubberBandFrameRect = hoveredFrameRect();
 
     if (location == DropLocation_None) {
         m_rubberBand->setVisible(false);
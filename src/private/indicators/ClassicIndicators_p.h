@@ -53,6 +53,7 @@ private:
     IndicatorWindow *const m_indicatorWindow;
     bool m_innerIndicatorsVisible = false;
     bool m_outterIndicatorsVisible = false;
+    QRect m_rubberBandFrameRect; // The hovered frame rect the rubber band geometry was computed for
 };
 
 }
@@ -41,8 +41,17 @@ SegmentedIndicators::~SegmentedIndicators()
 void SegmentedIndicators::hover_impl(QPoint pt)
 {
     m_hoveredPt = mapFromGlobal(pt);
-    updateSegments();
-    setCurrentDropLocation(dropLocationForPos(m_hoveredPt));
+    const DropLocation oldLocation = currentDropLocation();
+    const bool segmentsChanged = updateSegments();
+    const DropLocation newLocation = dropLocationForPos(m_hoveredPt);
+    setCurrentDropLocation(newLocation);
+
+    if (segmentsChanged) {
+        update();
+    } else if (oldLocation != newLocation) {
+        // Only the previously and newly highlighted segments need repainting, not the whole overlay
+        update(dirtyRectForSegment(oldLocation) | dirtyRectForSegment(newLocation));
+    }
 }
 
 DropIndicatorOverlayInterface::DropLocation SegmentedIndicators::dropLocationForPos(QPoint pos) const
@@ -131,13 +140,23 @@ QVector<QPolygon> SegmentedIndicators::segmentsForRect(QRect r, QPolygon &center
     return { leftPoints, topPoints, rightPoints, bottomPoints };
 }
 
-void SegmentedIndicators::updateSegments()
+bool SegmentedIndicators::updateSegments()
 {
-    m_segments.clear();
-
     const bool hasMultipleFrames = m_dropArea->count() > 1;
     const bool needsInnerIndicators = hoveredFrameRect().isValid();
     const bool needsOutterIndicators = hasMultipleFrames || !needsInnerIndicators;
+
+    if (!m_segments.isEmpty() && m_segmentsOverlayRect == rect()
+            && m_segmentsHoveredFrameRect == hoveredFrameRect()
+            && m_segmentsHaveOutterIndicators == needsOutterIndicators) {
+        // Nothing changed since last time
+        return false;
+    }
+
+    m_segments.clear();
+    m_segmentsOverlayRect = rect();
+    m_segmentsHoveredFrameRect = hoveredFrameRect();
+    m_segmentsHaveOutterIndicators = needsOutterIndicators;
     QPolygon center;
 
     if (needsInnerIndicators) {
@@ -155,16 +174,27 @@ void SegmentedIndicators::updateSegments()
             m_segments.insert(DropLocation(DropLocation_OutterLeft + i), segments[i]);
     }
 
-    update();
+    return true;
+}
+
+QRect SegmentedIndicators::dirtyRectForSegment(DropLocation location) const
+{
+    if (location == DropLocation_None)
+        return {};
+
+    // Account for the pen, which is drawn centered on the polygon's edges
+    const int margin = SEGMENT_PEN_WIDTH;
+    return m_segments.value(location).boundingRect().adjusted(-margin, -margin, margin, margin);
 }
 
 void SegmentedIndicators::drawSegments(QPainter *p)
 {
+    const DropLocation hoveredLocation = currentDropLocation();
     for (int i = DropLocation_First; i <= DropLocation_Last; ++i)
-        drawSegment(p, m_segments.value(DropLocation(i)));
+        drawSegment(p, m_segments.value(DropLocation(i)), i == hoveredLocation);
 }
 
-void SegmentedIndicators::drawSegment(QPainter *p, const QPolygon &segment)
+void SegmentedIndicators::drawSegment(QPainter *p, const QPolygon &segment, bool hovered)
 {
     if (segment.isEmpty())
         return;
@@ -174,7 +204,7 @@ void SegmentedIndicators::drawSegment(QPainter *p, const QPolygon &segment)
     p->setPen(pen);
     QColor brush(0xbb, 0xd5, 0xee, 200);
 
-    if (segment.containsPoint(m_hoveredPt, Qt::OddEvenFill))
+    if (hovered)
         brush = QColor(0x3574c5);
 
     p->setBrush(brush);
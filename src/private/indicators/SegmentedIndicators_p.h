@@ -34,11 +34,17 @@ protected:
 
 private:
     QVector<QPolygon> segmentsForRect(QRect, QPolygon &center, bool useOffset = false) const;
-    void updateSegments();
+    bool updateSegments();
     void drawSegments(QPainter *p);
-    void drawSegment(QPainter *p, const QPolygon &segment);
+    void drawSegment(QPainter *p, const QPolygon &segment, bool hovered);
+    QRect dirtyRectForSegment(DropLocation) const;
     QPoint m_hoveredPt = {};
     QHash<DropLocation, QPolygon> m_segments;
+
+    // The inputs m_segments was computed from, so we only recompute when they change
+    QRect m_segmentsOverlayRect;
+    QRect m_segmentsHoveredFrameRect;
+    bool m_segmentsHaveOutterIndicators = false;
 };
 
 }
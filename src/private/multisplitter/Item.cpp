@@ -13,13 +13,20 @@
 #include "Separator_p.h"
 #include "MultiSplitterConfig.h"
 #include "Widget.h"
+#include "Tracing_p.h"
 
 #include <QEvent>
 #include <QDebug>
 #include <QScopedValueRollback>
 #include <QTimer>
+#include <QPointer>
 #include <QGuiApplication>
 #include <QScreen>
+#include <QCache>
+#include <QDataStream>
+#include <QAtomicInteger>
+
+#include <algorithm>
 
 #ifdef Q_CC_MSVC
 # pragma warning(push)
@@ -39,6 +46,33 @@ const QSize Layouting::Item::hardcodedMaximumSize = QSize(KDDOCKWIDGETS_MAX_WIDT
 
 bool Layouting::ItemContainer::s_inhibitSimplify = false;
 
+namespace {
+///@brief The result of solving a layout: the geometry and percentage of every item, depth-first
+struct SolvedGeometries
+{
+    QVector<QRect> geometries;
+    QVector<double> percentages;
+};
+}
+
+// Atomic, as dummy containers can be solved in worker threads, see LayoutSaver::validateLayout()
+// 64-bit, as they accumulate since startup
+static QAtomicInteger<qint64> s_numGuestGeometryChanges(0);
+static QAtomicInteger<qint64> s_numRelayouts(0);
+static QAtomicInteger<qint64> s_numSolverAllocations(0);
+static QAtomicInteger<qint64> s_solvedGeometryCacheHits(0);
+static QAtomicInteger<qint64> s_solvedGeometryCacheMisses(0);
+
+static QCache<QByteArray, SolvedGeometries> &solvedGeometryCache()
+{
+    static QCache<QByteArray, SolvedGeometries> cache;
+    const int size = Config::self().solvedGeometryCacheSize();
+    if (cache.maxCost() != size)
+        cache.setMaxCost(size);
+
+    return cache;
+}
+
 inline bool locationIsVertical(Item::Location loc)
 {
     return loc == Item::Location_OnTop || loc == Item::Location_OnBottom;
@@ -180,6 +214,7 @@ void Item::setGuestWidget(Widget *guest)
         m_guest->setLayoutItem(this);
         newWidget->installEventFilter(this);
         m_guest->setParent(m_hostWidget);
+        m_guest->invalidateSizeConstraints();
         setMinSize(guest->minSize());
         setMaxSizeHint(guest->maxSizeHint());
 
@@ -203,10 +238,16 @@ void Item::setGuestWidget(Widget *guest)
 void Item::updateWidgetGeometries()
 {
     if (m_guest) {
+        s_numGuestGeometryChanges++;
         m_guest->setGeometry(mapToRoot(rect()));
     }
 }
 
+qint64 Item::guestGeometryChangeCount()
+{
+    return s_numGuestGeometryChanges;
+}
+
 QVariantMap Item::toVariantMap() const
 {
     QVariantMap result;
@@ -607,6 +648,7 @@ void Item::setIsVisible(bool is)
     }
 
     if (is && m_guest) {
+        s_numGuestGeometryChanges++;
         m_guest->setGeometry(mapToRoot(rect()));
         m_guest->setVisible(true); // TODO: Only set visible when apply*() ?
     }
@@ -822,6 +864,16 @@ void Item::onWidgetDestroyed()
 void Item::onWidgetLayoutRequested()
 {
     if (Widget *w = guestWidget()) {
+        w->invalidateSizeConstraints();
+
+        if (Config::self().flags() & Config::Flag::CoalesceSizeConstraints) {
+            if (ItemContainer *r = root()) {
+                // A burst of layout requests will only relayout once
+                r->scheduleSizeConstraintsUpdate(this);
+                return;
+            }
+        }
+
         if (w->size() != size()) {
             qDebug() << Q_FUNC_INFO << "TODO: Not implemented yet. Widget can't just decide to resize yet"
                        << w->size()
@@ -878,12 +930,36 @@ struct ItemContainer::Private
     QSize minSize(const Item::List &items) const;
     int excessLength() const;
 
+    ///@brief Appends all descendants, depth-first, parents before children
+    void collectItems_recursive(Item::List &items) const;
+
+    ///@brief Returns everything that solving this root for @p newSize depends on.
+    ///The Percentage strategy derives lengths from percentages, so current geometries are only part
+    ///of the key along an axis that doesn't change, where containers keep their children's lengths.
+    ///This way a root going back and forth between two sizes, like when maximizing, reuses its solves.
+    ///The whole input is the key, instead of a hash of it, so different layouts never collide.
+    QByteArray solvedGeometryCacheKey(QSize newSize) const;
+    bool applyCachedGeometries(const QByteArray &key);
+    void cacheSolvedGeometries(const QByteArray &key, const QVector<QRect> &oldGeometries) const;
+
+    ///@brief Returns the geometries of this container and its descendants, in collectItems_recursive() order
+    QVector<QRect> geometries_recursive() const;
+
+    ///@brief Returns whether each container's width and height changed between @p from and @p to
+    ///exactly when the root's did. Only then does the key describe the solve, as rounding can
+    ///leave a nested container's length unchanged, and it would then keep its children's lengths.
+    bool containersResizeLikeRoot(const QVector<QRect> &from, const QVector<QRect> &to) const;
+
     mutable bool m_checkSanityScheduled = false;
     QVector<Layouting::Separator*> m_separators;
     bool m_convertingItemToContainer = false;
     bool m_blockUpdatePercentages = false;
     bool m_isDeserializing = false;
     bool m_isSimplifying = false;
+    bool m_sizeConstraintsUpdateScheduled = false;
+    bool m_processingSizeConstraints = false;
+    QVector<QPointer<Item>> m_pendingSizeConstraints;
+    Item::List m_sizeConstraintsQueue;
     Qt::Orientation m_orientation = Qt::Vertical;
     Item::List m_children;
     ItemContainer *const q;
@@ -919,20 +995,10 @@ ItemContainer::~ItemContainer()
     delete d;
 }
 
-bool ItemContainer::checkSanity()
+bool ItemContainer::checkChildGeometries() const
 {
-    d->m_checkSanityScheduled = false;
-
-    if (!hostWidget()) {
-        /// This is a dummy ItemContainer, just return true
-        return true;
-    }
-
-    if (!Item::checkSanity())
-        return false;
-
     if (numChildren() == 0 && !isRoot()) {
-        qWarning() << Q_FUNC_INFO << "Container is empty. Should be deleted";
+        qWarning() << Q_FUNC_INFO << "Container is empty. Should be deleted" << this;
         return false;
     }
 
@@ -941,69 +1007,46 @@ bool ItemContainer::checkSanity()
         return false;
     }
 
-    // Check that the geometries don't overlap
+    // Check that the geometries don't overlap and fill the container
+    const Item::List visibleChildren = this->visibleChildren();
+    const int oppositeLength = Layouting::length(size(), oppositeOrientation(d->m_orientation));
     int expectedPos = 0;
-    for (Item *item : qAsConst(d->m_children)) {
-        if (!item->isVisible())
-            continue;
+    for (Item *item : visibleChildren) {
+        const QSize min = item->minSize();
+        if (min.width() > item->width() || min.height() > item->height()) {
+            qWarning() << Q_FUNC_INFO << "Size constraints not honoured" << item
+                       << "; min=" << min << "; size=" << item->size();
+            return false;
+        }
+
         const int pos = Layouting::pos(item->pos(), d->m_orientation);
-        if (expectedPos != pos) {
-            root()->dumpLayout();
+        if (pos != expectedPos) {
             qWarning() << Q_FUNC_INFO << "Unexpected pos" << pos << "; expected=" << expectedPos
                        << "; for item=" << item
                        << "; isContainer=" << item->isContainer();
             return false;
         }
+        expectedPos = pos + item->length(d->m_orientation) + separatorThickness;
 
-        expectedPos = pos + Layouting::length(item->size(), d->m_orientation) + separatorThickness;
-    }
-
-    const int h1 = Layouting::length(size(), oppositeOrientation(d->m_orientation));
-    for (Item *item : qAsConst(d->m_children)) {
-        if (item->parentContainer() != this) {
-            qWarning() << "Invalid parent container for" << item
-                       << "; is=" << item->parentContainer() << "; expected=" << this;
+        // Check the children height (if horizontal, and vice-versa)
+        const int itemOppositeLength = Layouting::length(item->size(), oppositeOrientation(d->m_orientation));
+        if (itemOppositeLength != oppositeLength) {
+            qWarning() << Q_FUNC_INFO << "Invalid size for item." << item
+                       << "Container.length=" << oppositeLength << "; item.length=" << itemOppositeLength;
             return false;
         }
 
-        if (item->parent() != this) {
-            qWarning() << "Invalid QObject parent for" << item
-                       << "; is=" << item->parent() << "; expected=" << this;
+        if (!rect().contains(item->geometry())) {
+            qWarning() << Q_FUNC_INFO << "Item geo is out of bounds. item=" << item
+                       << "; geo=" << item->geometry() << "; parent.rect=" << rect();
             return false;
         }
-
-        if (item->isVisible()) {
-            // Check the children height (if horizontal, and vice-versa)
-            const int h2 = Layouting::length(item->size(), oppositeOrientation(d->m_orientation));
-            if (h1 != h2) {
-                root()->dumpLayout();
-                qWarning() << Q_FUNC_INFO << "Invalid size for item." << item
-                           << "Container.length=" << h1 << "; item.length=" << h2;
-                return false;
-            }
-
-            if (!rect().contains(item->geometry())) {
-                root()->dumpLayout();
-                qWarning() << Q_FUNC_INFO << "Item geo is out of bounds. item=" << item << "; geo="
-                           << item->geometry() << "; parent.rect=" << rect();
-                return false;
-            }
-        }
-
-        if (!item->checkSanity())
-            return false;
     }
 
-    const Item::List visibleChildren = this->visibleChildren();
     const bool isEmptyRoot = isRoot() && visibleChildren.isEmpty();
     if (!isEmptyRoot) {
-        int occupied = qMax(0, Item::separatorThickness * (visibleChildren.size() - 1));
-        for (Item *item : visibleChildren) {
-            occupied += item->length(d->m_orientation);
-        }
-
+        const int occupied = qMax(0, expectedPos - separatorThickness);
         if (occupied != length()) {
-            root()->dumpLayout();
             qWarning() << Q_FUNC_INFO << "Unexpected length. Expected=" << occupied
                        << "; got=" << length() << "; this=" << this;
             return false;
@@ -1013,16 +1056,66 @@ bool ItemContainer::checkSanity()
         const double totalPercentage = std::accumulate(percentages.begin(), percentages.end(), 0.0);
         const double expectedPercentage = visibleChildren.isEmpty() ? 0.0 : 1.0;
         if (!qFuzzyCompare(totalPercentage, expectedPercentage)) {
-            root()->dumpLayout();
             qWarning() << Q_FUNC_INFO << "Percentages don't add up"
                        << totalPercentage << percentages
                        << this;
-            const_cast<ItemContainer*>(this)->d->updateSeparators_recursive();
-            qWarning() << Q_FUNC_INFO << d->childPercentages();
             return false;
         }
     }
 
+    return true;
+}
+
+bool ItemContainer::checkGeometries_recursive() const
+{
+    if (!checkChildGeometries())
+        return false;
+
+    for (Item *item : visibleChildren()) {
+        if (auto container = qobject_cast<ItemContainer *>(item)) {
+            if (!container->checkGeometries_recursive())
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool ItemContainer::checkSanity()
+{
+    d->m_checkSanityScheduled = false;
+
+    if (!hostWidget()) {
+        /// This is a dummy ItemContainer, just return true
+        return true;
+    }
+
+    if (!Item::checkSanity())
+        return false;
+
+    if (!checkChildGeometries()) {
+        root()->dumpLayout();
+        return false;
+    }
+
+    for (Item *item : qAsConst(d->m_children)) {
+        if (item->parentContainer() != this) {
+            qWarning() << "Invalid parent container for" << item
+                       << "; is=" << item->parentContainer() << "; expected=" << this;
+            return false;
+        }
+
+        if (item->parent() != this) {
+            qWarning() << "Invalid QObject parent for" << item
+                       << "; is=" << item->parent() << "; expected=" << this;
+            return false;
+        }
+
+        if (!item->checkSanity())
+            return false;
+    }
+
+    const Item::List visibleChildren = this->visibleChildren();
     const int numVisibleChildren = visibleChildren.size();
     if (d->m_separators.size() != qMax(0, numVisibleChildren - 1)) {
         root()->dumpLayout();
@@ -1151,6 +1244,7 @@ const Item::List ItemContainer::childItems() const
 
 void ItemContainer::removeItem(Item *item, bool hardRemove)
 {
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::removeItem");
     Q_ASSERT(!item->isRoot());
 
     if (!contains(item)) {
@@ -1239,6 +1333,7 @@ ItemContainer *ItemContainer::convertChildToContainer(Item *leaf)
 void ItemContainer::insertItem(Item *item, Location loc, DefaultSizeMode defaultSizeMode,
                                AddingOption addingOption)
 {
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::insertItem");
     Q_ASSERT(item != this);
     if (contains(item)) {
         qWarning() << Q_FUNC_INFO << "Item already exists";
@@ -1317,10 +1412,119 @@ void ItemContainer::updateSizeConstraints()
         }
     }
 
+    ItemContainer *r = root();
+    if (r->d->m_processingSizeConstraints) {
+        // Our parent is notified later, once all our siblings were processed too
+        if (!r->d->m_sizeConstraintsQueue.contains(this))
+            r->d->m_sizeConstraintsQueue.push_back(this);
+        return;
+    }
+
     // Our min-size changed, notify our parent, and so on until it reaches root()
     Q_EMIT minSizeChanged(this);
 }
 
+void ItemContainer::scheduleSizeConstraintsUpdate(Item *item)
+{
+    Q_ASSERT(isRoot());
+    if (!d->m_pendingSizeConstraints.contains(item))
+        d->m_pendingSizeConstraints.push_back(item);
+
+    if (!d->m_sizeConstraintsUpdateScheduled) {
+        d->m_sizeConstraintsUpdateScheduled = true;
+        QTimer::singleShot(0, this, &ItemContainer::processPendingSizeConstraints);
+    }
+}
+
+static int depthOf(const Item *item)
+{
+    int depth = 0;
+    while ((item = item->parentContainer()))
+        ++depth;
+    return depth;
+}
+
+void ItemContainer::processPendingSizeConstraints()
+{
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::processPendingSizeConstraints");
+    d->m_sizeConstraintsUpdateScheduled = false;
+    const QVector<QPointer<Item>> pending = d->m_pendingSizeConstraints;
+    d->m_pendingSizeConstraints.clear();
+
+    bool rootMinSizeChanged = false;
+    {
+        QScopedValueRollback<bool> guard(d->m_processingSizeConstraints, true);
+        Item::List &queue = d->m_sizeConstraintsQueue;
+
+        // Store the new constraints without notifying anyone yet
+        for (Item *item : pending) {
+            if (!item || !item->guestWidget())
+                continue;
+
+            if (item->root() != this) {
+                // Moved to another layout meanwhile
+                item->onWidgetLayoutRequested();
+                continue;
+            }
+
+            Widget *guest = item->guestWidget();
+            item->setMaxSizeHint(guest->maxSizeHint());
+            const QSize minSize = guest->minSize();
+            if (minSize != item->minSize()) {
+                item->m_sizingInfo.minSize = minSize;
+                queue.push_back(item);
+            }
+        }
+
+        // Then let each container grow its children, deepest first, so each container only
+        // propagates to its parent after all its children were handled.
+        // Sorted by depth once, the containers queued meanwhile are inserted in place.
+        using DepthAndItem = QPair<int, Item *>;
+        const auto byDepth = [] (const DepthAndItem &a, const DepthAndItem &b) {
+            return a.first < b.first;
+        };
+
+        QVector<DepthAndItem> sorted;
+        sorted.reserve(queue.size());
+        for (Item *item : qAsConst(queue))
+            sorted.push_back({ depthOf(item), item });
+        std::sort(sorted.begin(), sorted.end(), byDepth);
+        queue.clear();
+
+        while (!sorted.isEmpty()) {
+            Item *item = sorted.takeLast().second;
+
+            if (item->parentContainer()) {
+                // The parent's onChildMinSizeChanged() is connected to it
+                Q_EMIT item->minSizeChanged(item);
+                if (!item->isContainer())
+                    item->setSize_recursive(item->size().expandedTo(item->minSize()));
+            } else {
+                rootMinSizeChanged = true;
+            }
+
+            for (Item *queued : qAsConst(queue)) {
+                const bool alreadySorted = std::any_of(sorted.cbegin(), sorted.cend(), [queued] (const DepthAndItem &entry) {
+                    return entry.second == queued;
+                });
+                if (!alreadySorted) {
+                    const DepthAndItem entry(depthOf(queued), queued);
+                    sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), entry, byDepth), entry);
+                }
+            }
+            queue.clear();
+        }
+    }
+
+    if (rootMinSizeChanged)
+        Q_EMIT minSizeChanged(this);
+}
+
+bool ItemContainer::hasPendingSizeConstraints() const
+{
+    return !d->m_pendingSizeConstraints.isEmpty();
+}
+
 void ItemContainer::onChildVisibleChanged(Item *, bool visible)
 {
     if (d->m_isDeserializing || isInSimplify())
@@ -1677,6 +1881,7 @@ void ItemContainer::setLength_recursive(int length, Qt::Orientation o)
 
 void ItemContainer::insertItem(Item *item, int index, DefaultSizeMode defaultSizeMode)
 {
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::insertItem(index)");
     if (defaultSizeMode != DefaultSizeMode::None) {
         /// Choose a nice size for the item we're adding
         const int suggestedLength = d->defaultLengthFor(item, defaultSizeMode);
@@ -2048,6 +2253,7 @@ void ItemContainer::Private::honourMaxSizes(SizingInfo::List &sizes)
 
 void ItemContainer::setSize_recursive(QSize newSize, ChildrenResizeStrategy strategy)
 {
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::setSize_recursive");
     QScopedValueRollback<bool> block(d->m_blockUpdatePercentages, true);
 
     const QSize minSize = this->minSize();
@@ -2062,6 +2268,19 @@ void ItemContainer::setSize_recursive(QSize newSize, ChildrenResizeStrategy stra
     if (newSize == size())
         return;
 
+    if (isRoot())
+        s_numRelayouts++;
+
+    // Solving is deterministic, so the root can reuse the result of an identical previous solve
+    QByteArray cacheKey;
+    QVector<QRect> oldGeometries;
+    if (isRoot() && !d->isDummy() && strategy == ChildrenResizeStrategy::Percentage && Config::self().solvedGeometryCacheSize() > 0) {
+        cacheKey = d->solvedGeometryCacheKey(newSize);
+        if (d->applyCachedGeometries(cacheKey))
+            return;
+        oldGeometries = d->geometries_recursive();
+    }
+
     const QSize oldSize = size();
     setSize(newSize);
 
@@ -2092,6 +2311,47 @@ void ItemContainer::setSize_recursive(QSize newSize, ChildrenResizeStrategy stra
 
     // #3 Sizes are now correct and honour min/max sizes. So apply them to our Items
     applyGeometries(childSizes, strategy);
+
+    if (!cacheKey.isEmpty())
+        d->cacheSolvedGeometries(cacheKey, oldGeometries);
+}
+
+int ItemContainer::containerCount_recursive() const
+{
+    int count = 0;
+    for (Item *item : qAsConst(d->m_children)) {
+        if (auto c = item->asContainer())
+            count += 1 + c->containerCount_recursive();
+    }
+
+    return count;
+}
+
+qint64 ItemContainer::relayoutCount()
+{
+    return s_numRelayouts;
+}
+
+qint64 ItemContainer::solverAllocationCount()
+{
+    return s_numSolverAllocations;
+}
+
+qint64 ItemContainer::solvedGeometryCacheHits()
+{
+    return s_solvedGeometryCacheHits;
+}
+
+qint64 ItemContainer::solvedGeometryCacheMisses()
+{
+    return s_solvedGeometryCacheMisses;
+}
+
+void ItemContainer::clearSolvedGeometryCache()
+{
+    solvedGeometryCache().clear();
+    s_solvedGeometryCacheHits = 0;
+    s_solvedGeometryCacheMisses = 0;
 }
 
 int ItemContainer::length() const
@@ -2265,6 +2525,7 @@ int ItemContainer::oppositeLength() const
 
 void ItemContainer::requestSeparatorMove(Separator *separator, int delta)
 {
+    KDDW_TRACE_SCOPE("layout", "ItemContainer::requestSeparatorMove");
     const int separatorIndex = d->m_separators.indexOf(separator);
     if (separatorIndex == -1) {
         // Doesn't happen
@@ -2905,6 +3166,7 @@ SizingInfo::List ItemContainer::sizes(bool ignoreBeingInserted) const
     const Item::List children = visibleChildren(ignoreBeingInserted);
     SizingInfo::List result;
     result.reserve(children.count());
+    s_numSolverAllocations++;
     for (Item *item : children) {
         if (item->isContainer()) {
             // Containers have virtual min/maxSize methods, and don't really fill in these properties
@@ -3374,6 +3636,131 @@ bool ItemContainer::Private::isOverflowing() const
     return contentsLength > q->length();
 }
 
+void ItemContainer::Private::collectItems_recursive(Item::List &items) const
+{
+    for (Item *item : qAsConst(m_children)) {
+        items.push_back(item);
+        if (auto c = item->asContainer())
+            c->d->collectItems_recursive(items);
+    }
+}
+
+QByteArray ItemContainer::Private::solvedGeometryCacheKey(QSize newSize) const
+{
+    Item::List items = { q };
+    collectItems_recursive(items);
+
+    const bool widthChanges = q->width() != newSize.width();
+    const bool heightChanges = q->height() != newSize.height();
+
+    QByteArray key;
+    QDataStream stream(&key, QIODevice::WriteOnly);
+    stream << newSize << Item::separatorThickness << widthChanges << heightChanges;
+    for (Item *item : qAsConst(items)) {
+        // Structure
+        stream << item->isVisible() << item->isBeingInserted() << item->m_sizingInfo.percentageWithinParent;
+
+        // Lengths along an unchanged axis are kept, instead of being derived from percentages
+        const QRect geo = item->m_sizingInfo.geometry;
+        if (!widthChanges)
+            stream << geo.x() << geo.width();
+        if (!heightChanges)
+            stream << geo.y() << geo.height();
+
+        if (auto c = item->asContainer()) {
+            stream << int(c->d->m_orientation) << c->d->m_children.size();
+        } else {
+            // Constraints. A container's are derived from its children's.
+            stream << item->minSize() << item->maxSizeHint();
+        }
+    }
+
+    return key;
+}
+
+bool ItemContainer::Private::applyCachedGeometries(const QByteArray &key)
+{
+    SolvedGeometries *solved = solvedGeometryCache().object(key);
+    if (!solved || !containersResizeLikeRoot(geometries_recursive(), solved->geometries)) {
+        s_solvedGeometryCacheMisses++;
+        return false;
+    }
+
+    KDDW_TRACE_INSTANT("layout", "SolvedGeometryCacheHit");
+
+    Item::List items = { q };
+    collectItems_recursive(items);
+    Q_ASSERT(items.size() == solved->geometries.size());
+
+    // Parents first, so guests end up mapped with their final parent geometry
+    const int count = items.size();
+    for (int i = 0; i < count; ++i)
+        items.at(i)->setGeometry(solved->geometries.at(i));
+
+    // Only now, as setting geometries can update percentages
+    for (int i = 0; i < count; ++i)
+        items.at(i)->m_sizingInfo.percentageWithinParent = solved->percentages.at(i);
+
+    updateSeparators_recursive();
+    s_solvedGeometryCacheHits++;
+
+    return true;
+}
+
+void ItemContainer::Private::cacheSolvedGeometries(const QByteArray &key, const QVector<QRect> &oldGeometries) const
+{
+    Item::List items = { q };
+    collectItems_recursive(items);
+
+    auto solved = new SolvedGeometries();
+    solved->geometries.reserve(items.size());
+    solved->percentages.reserve(items.size());
+    for (Item *item : qAsConst(items)) {
+        solved->geometries.push_back(item->m_sizingInfo.geometry);
+        solved->percentages.push_back(item->m_sizingInfo.percentageWithinParent);
+    }
+
+    if (!containersResizeLikeRoot(oldGeometries, solved->geometries)) {
+        delete solved;
+        return;
+    }
+
+    solvedGeometryCache().insert(key, solved);
+}
+
+QVector<QRect> ItemContainer::Private::geometries_recursive() const
+{
+    Item::List items = { q };
+    collectItems_recursive(items);
+
+    QVector<QRect> geometries;
+    geometries.reserve(items.size());
+    for (Item *item : qAsConst(items))
+        geometries.push_back(item->m_sizingInfo.geometry);
+
+    return geometries;
+}
+
+bool ItemContainer::Private::containersResizeLikeRoot(const QVector<QRect> &from, const QVector<QRect> &to) const
+{
+    Item::List items = { q };
+    collectItems_recursive(items);
+    if (items.size() != from.size() || items.size() != to.size())
+        return false;
+
+    const bool widthChanges = from.at(0).width() != to.at(0).width();
+    const bool heightChanges = from.at(0).height() != to.at(0).height();
+    for (int i = 1; i < items.size(); ++i) {
+        if (!items.at(i)->isContainer())
+            continue;
+        if ((from.at(i).width() != to.at(i).width()) != widthChanges ||
+            (from.at(i).height() != to.at(i).height()) != heightChanges)
+            return false;
+    }
+
+    return true;
+}
+
 void ItemContainer::Private::relayoutIfNeeded()
 {
     // Checks all the child containers if they have the correct min-size, recursively.
@@ -261,6 +261,10 @@ public:
     static const QSize hardcodedMaximumSize;
     static int separatorThickness;
 
+    ///@brief Returns how many times a guest widget got its geometry set, summed over all items.
+    /// For profiling.
+    static qint64 guestGeometryChangeCount();
+
     int x() const;
     int y() const;
     int width() const;
@@ -394,12 +398,42 @@ public:
     Item* itemForWidget(const Widget *w) const;
     Item::List items_recursive() const;
     Q_REQUIRED_RESULT bool checkSanity() override;
+
+    ///@brief Checks that the item geometries honour the size constraints and don't overlap.
+    ///Unlike checkSanity() this also works on dummy containers, which have no host widget, no
+    ///guests and no separators, so a serialized layout can be validated without widgets.
+    Q_REQUIRED_RESULT bool checkGeometries_recursive() const;
+
     void dumpLayout(int level = 0) override;
     void setSize_recursive(QSize newSize, ChildrenResizeStrategy strategy = ChildrenResizeStrategy::Percentage) override;
     QRect suggestedDropRect(const Item *item, const Item *relativeTo, Location) const;
     QVariantMap toVariantMap() const override;
     void fillFromVariantMap(const QVariantMap &map, const QHash<QString, Widget *> &widgets) override;
     void clear();
+
+    ///@brief Returns how many root resizes were served from the solved geometry cache, and how many
+    ///had to be solved. See Config::setSolvedGeometryCacheSize(). For profiling and tests.
+    static qint64 solvedGeometryCacheHits();
+    static qint64 solvedGeometryCacheMisses();
+
+    ///@brief Discards all cached solved geometries and resets the hit/miss counters
+    static void clearSolvedGeometryCache();
+
+    ///@brief Returns the number of nested containers, not counting this one
+    int containerCount_recursive() const;
+
+    ///@brief Returns how many times a root item was resized, relayouting its whole tree. For profiling.
+    static qint64 relayoutCount();
+
+    ///@brief Returns how many sizing lists the solver allocated. For profiling.
+    static qint64 solverAllocationCount();
+
+    ///@brief Applies what scheduleSizeConstraintsUpdate() queued, without waiting for the next
+    ///event loop iteration
+    void processPendingSizeConstraints();
+
+    ///@brief Returns whether scheduleSizeConstraintsUpdate() queued something not yet applied
+    bool hasPendingSizeConstraints() const;
 private:
     bool isEmpty() const;
     bool hasOrientation() const;
@@ -427,6 +461,10 @@ private:
     void updateWidgetGeometries() override;
     int oppositeLength() const;
 
+    ///@brief The geometry checks of checkSanity() and checkGeometries_recursive() for this
+    ///container's direct children. Doesn't need a host widget.
+    bool checkChildGeometries() const;
+
     void layoutEqually(SizingInfo::List &sizes);
 
     ///@brief Grows the side1Neighbour to the right and the side2Neighbour to the left
@@ -469,6 +507,12 @@ private:
     void onChildMinSizeChanged(Item *child);
     void onChildVisibleChanged(Item *child, bool visible);
     void updateSizeConstraints();
+
+    ///@brief Queues the guest size constraints of @p item to be applied in the next event loop
+    ///iteration, all at once and bottom-up. Called on the root item when using
+    ///Config::Flag::CoalesceSizeConstraints
+    void scheduleSizeConstraintsUpdate(Item *item);
+
     SizingInfo::List sizes(bool ignoreBeingInserted = false) const;
     QVector<int> calculateSqueezes(SizingInfo::List::ConstIterator begin,
                                    SizingInfo::List::ConstIterator end, int needed,
@@ -13,6 +13,7 @@
 #include "Widget_qwidget.h"
 #include "Item_p.h"
 #include "Separator_p.h"
+#include "Tracing_p.h"
 
 #ifdef KDMULTISPLITTER_QTQUICK
 # include <QQmlEngine>
@@ -24,6 +25,9 @@ namespace Layouting
 Config::Config()
 {
     registerQmlTypes();
+#ifdef KDDOCKWIDGETS_TRACING
+    (void) Tracer::self(); // Starts recording if KDDOCKWIDGETS_TRACE_FILE is set
+#endif
 }
 
 Separator *Config::createSeparator(Widget *parent) const
@@ -98,4 +102,21 @@ void Config::setFlags(Flags flags)
     m_flags = flags;
 }
 
+int Config::solvedGeometryCacheSize() const
+{
+    return m_solvedGeometryCacheSize;
+}
+
+void Config::setSolvedGeometryCacheSize(int size)
+{
+    if (size < 0) {
+        qWarning() << Q_FUNC_INFO << "Invalid value" << size;
+        return;
+    }
+
+    m_solvedGeometryCacheSize = size;
+    if (size == 0)
+        ItemContainer::clearSolvedGeometryCache();
+}
+
 }
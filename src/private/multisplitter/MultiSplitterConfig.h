@@ -27,7 +27,9 @@ public:
 
     enum class Flag {
         None = 0,
-        LazyResize = 1
+        LazyResize = 1,
+        CoalesceSizeConstraints = 2, ///< Guest min/max size changes are applied once per event loop iteration
+        BatchGeometryUpdates = 4 ///< QtQuick only. Guest geometries are applied once per frame, in the window's polish phase
     };
     Q_DECLARE_FLAGS(Flags, Flag);
 
@@ -60,6 +62,20 @@ public:
     ///@brief sets the flags. Set only before creating any Item
     void setFlags(Flags);
 
+    /**
+     * @brief Returns how many solved layouts are remembered, 0 by default (disabled).
+     *
+     * When the root item is resized, the geometries computed for its whole tree are cached, keyed
+     * on the tree structure, size constraints, current geometries and the new size. Resizing an
+     * identical layout to the same size again, like when toggling a window between maximized and
+     * normal, then applies the cached geometries instead of solving the layout again.
+     * The least recently used entries are discarded first.
+     */
+    int solvedGeometryCacheSize() const;
+
+    ///@brief setter for @ref solvedGeometryCacheSize
+    void setSolvedGeometryCacheSize(int);
+
 private:
     friend class Item;
     friend class ItemContainer;
@@ -71,6 +87,7 @@ private:
 
     SeparatorFactoryFunc m_separatorFactoryFunc = nullptr;
     Flags m_flags = Flag::None;
+    int m_solvedGeometryCacheSize = 0;
 
     Q_DISABLE_COPY(Config);
 };
@@ -0,0 +1,125 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Tracing_p.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+
+using namespace Layouting;
+
+static qint64 currentThreadId()
+{
+    return qint64(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+}
+
+QAtomicInt Tracer::s_isRecording(0);
+
+Tracer::Tracer()
+{
+    m_clock.start();
+
+    const QString filename = QString::fromLocal8Bit(qgetenv("KDDOCKWIDGETS_TRACE_FILE"));
+    if (!filename.isEmpty()) {
+        start(filename);
+        // Write the trace on exit, while QCoreApplication still exists
+        qAddPostRoutine([] { Tracer::self().stop(); });
+    }
+}
+
+Tracer::~Tracer()
+{
+}
+
+Tracer &Tracer::self()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::start(const QString &filename)
+{
+    QMutexLocker locker(&m_mutex);
+    m_filename = filename;
+    m_events.clear();
+    m_events.reserve(10000);
+    s_isRecording = 1;
+}
+
+bool Tracer::stop()
+{
+    // Only one stop() writes the trace, if called concurrently
+    if (!s_isRecording.testAndSetOrdered(1, 0))
+        return true;
+
+    QMutexLocker locker(&m_mutex);
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QJsonArray traceEvents;
+    for (const Event &event : qAsConst(m_events)) {
+        QJsonObject json;
+        json.insert(QStringLiteral("cat"), QLatin1String(event.category));
+        json.insert(QStringLiteral("name"), QLatin1String(event.name));
+        json.insert(QStringLiteral("ts"), event.timestamp);
+        json.insert(QStringLiteral("pid"), pid);
+        json.insert(QStringLiteral("tid"), event.threadId);
+        if (event.duration == -1) {
+            json.insert(QStringLiteral("ph"), QStringLiteral("i"));
+            json.insert(QStringLiteral("s"), QStringLiteral("t"));
+        } else {
+            json.insert(QStringLiteral("ph"), QStringLiteral("X"));
+            json.insert(QStringLiteral("dur"), event.duration);
+        }
+        traceEvents.push_back(json);
+    }
+
+    QJsonObject root;
+    root.insert(QStringLiteral("traceEvents"), traceEvents);
+    root.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ms"));
+
+    QFile f(m_filename);
+    if (!f.open(QIODevice::WriteOnly)) {
+        qWarning() << Q_FUNC_INFO << "Failed to open" << m_filename << f.errorString();
+        return false;
+    }
+
+    f.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return true;
+}
+
+int Tracer::eventCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_events.size();
+}
+
+qint64 Tracer::now() const
+{
+    return m_clock.nsecsElapsed() / 1000;
+}
+
+void Tracer::addCompleteEvent(const char *category, const char *name, qint64 start, qint64 duration)
+{
+    QMutexLocker locker(&m_mutex);
+    m_events.push_back({ category, name, start, duration, currentThreadId() });
+}
+
+void Tracer::addInstantEvent(const char *category, const char *name)
+{
+    const qint64 timestamp = now();
+    QMutexLocker locker(&m_mutex);
+    m_events.push_back({ category, name, timestamp, -1, currentThreadId() });
+}
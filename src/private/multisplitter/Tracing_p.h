@@ -0,0 +1,125 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#ifndef KD_DOCKWIDGETS_MULTISPLITTER_TRACING_P_H
+#define KD_DOCKWIDGETS_MULTISPLITTER_TRACING_P_H
+
+#include "multisplitter_export.h"
+
+#include <QAtomicInt>
+#include <QString>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QVector>
+
+/**
+ * @file
+ * @brief Trace-event instrumentation of the hot paths, viewable in chrome://tracing or Perfetto.
+ *
+ * Compiled in only with the OPTION_TRACING CMake option, otherwise the KDDW_TRACE_* macros expand
+ * to nothing. At runtime, recording starts when the KDDOCKWIDGETS_TRACE_FILE environment variable
+ * names the file to write the trace to, or with Tracer::start(). While not recording a trace point
+ * costs a single branch. Events can be recorded from any thread.
+ */
+
+namespace Layouting {
+
+class MULTISPLITTER_EXPORT Tracer
+{
+public:
+    ///@brief returns the singleton Tracer instance
+    static Tracer &self();
+
+    ///@brief destructor, called at shutdown
+    ~Tracer();
+
+    ///@brief Starts recording. Events will be written to @p filename when stop() is called
+    void start(const QString &filename);
+
+    ///@brief Stops recording and writes the trace-event JSON. Returns false if the file can't be written
+    bool stop();
+
+    ///@brief returns whether trace events are being recorded
+    static bool isRecording()
+    {
+        return s_isRecording != 0;
+    }
+
+    ///@brief returns the number of events recorded since start(). For tests.
+    int eventCount() const;
+
+    ///@brief Microseconds since the Tracer was created
+    qint64 now() const;
+
+    ///@brief Records an event with a duration. @p category and @p name must be string literals
+    void addCompleteEvent(const char *category, const char *name, qint64 start, qint64 duration);
+
+    ///@brief Records an event without duration. @p category and @p name must be string literals
+    void addInstantEvent(const char *category, const char *name);
+
+private:
+    Tracer();
+    Q_DISABLE_COPY(Tracer)
+
+    struct Event {
+        const char *category;
+        const char *name;
+        qint64 timestamp;
+        qint64 duration; // -1 for instant events
+        qint64 threadId;
+    };
+
+    static QAtomicInt s_isRecording; // read without locking by every trace point, from any thread
+    QElapsedTimer m_clock;
+    QString m_filename;
+    mutable QMutex m_mutex; // protects m_events
+    QVector<Event> m_events;
+};
+
+///@brief Records a complete event spanning its lifetime
+class ScopedTrace
+{
+public:
+    ScopedTrace(const char *category, const char *name)
+        : m_category(category)
+        , m_name(name)
+        , m_start(Tracer::isRecording() ? Tracer::self().now() : -1)
+    {
+    }
+
+    ~ScopedTrace()
+    {
+        if (m_start != -1 && Tracer::isRecording())
+            Tracer::self().addCompleteEvent(m_category, m_name, m_start, Tracer::self().now() - m_start);
+    }
+
+private:
+    Q_DISABLE_COPY(ScopedTrace)
+    const char *const m_category;
+    const char *const m_name;
+    const qint64 m_start;
+};
+
+}
+
+#ifdef KDDOCKWIDGETS_TRACING
+# define KDDW_TRACE_CONCAT_IMPL(a, b) a##b
+# define KDDW_TRACE_CONCAT(a, b) KDDW_TRACE_CONCAT_IMPL(a, b)
+# define KDDW_TRACE_SCOPE(category, name) \
+    const Layouting::ScopedTrace KDDW_TRACE_CONCAT(kddw_scoped_trace_, __LINE__)(category, name)
+# define KDDW_TRACE_INSTANT(category, name) \
+    do { if (Layouting::Tracer::isRecording()) Layouting::Tracer::self().addInstantEvent(category, name); } while (false)
+#else
+# define KDDW_TRACE_SCOPE(category, name) do {} while (false)
+# define KDDW_TRACE_INSTANT(category, name) do {} while (false)
+#endif
+
+#endif
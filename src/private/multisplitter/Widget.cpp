@@ -15,6 +15,7 @@
 using namespace Layouting;
 
 static qint64 s_nextFrameId = 1;
+static qint64 s_numSizeConstraintsComputations = 0;
 
 Widget::Widget(QObject *thisObj)
     : m_id(QString::number(s_nextFrameId++))
@@ -31,6 +32,16 @@ QString Widget::id() const
     return m_id;
 }
 
+qint64 Widget::sizeConstraintsComputationCount()
+{
+    return s_numSizeConstraintsComputations;
+}
+
+void Widget::countSizeConstraintsComputation()
+{
+    s_numSizeConstraintsComputations++;
+}
+
 QSize Widget::boundedMaxSize(QSize min, QSize max)
 {
     // Max should be bigger than min, but not bigger than the hardcoded max
@@ -71,6 +71,13 @@ public:
     virtual void hide() = 0;
     virtual void update() = 0;
 
+    ///@brief Drops any cached minSize() and maxSizeHint(). Called when the guest's layout is invalidated.
+    virtual void invalidateSizeConstraints() {}
+
+    ///@brief Returns how many times min/max sizes were actually computed instead of served from a cache.
+    /// Summed over all widgets. For profiling and tests.
+    static qint64 sizeConstraintsComputationCount();
+
     QSize size() const {
         return geometry().size();
     }
@@ -132,6 +139,7 @@ public:
 
 protected:
     static QSize boundedMaxSize(QSize min, QSize max);
+    static void countSizeConstraintsComputation();
 
 private:
     const QString m_id;
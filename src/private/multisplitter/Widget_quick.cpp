@@ -10,12 +10,64 @@
 */
 
 #include "Widget_quick.h"
+#include "MultiSplitterConfig.h"
 
 #include <QDebug>
+#include <QHash>
+#include <QPair>
+#include <QPointer>
+#include <QQmlComponent>
 #include <QQmlEngine>
+#include <QQuickWindow>
 
 using namespace Layouting;
 
+typedef QPair<QQmlEngine *, QString> ComponentKey;
+
+// Components are children of their engine, so the entries of a deleted engine become null
+static QHash<ComponentKey, QPointer<QQmlComponent>> s_components;
+
+struct PendingGeometry {
+    QPointer<QQuickItem> item;
+    QRect geometry;
+};
+
+// Geometries not applied yet, see Config::Flag::BatchGeometryUpdates
+static QHash<QQuickItem *, PendingGeometry> s_pendingGeometries;
+
+namespace {
+
+///@brief Invisible item which applies the pending geometries during its window's polish phase,
+///which happens once per frame, before the scene graph is synchronized
+class GeometrySync : public QQuickItem
+{
+public:
+    explicit GeometrySync(QQuickWindow *window)
+        : QQuickItem(window->contentItem())
+    {
+        setObjectName(QStringLiteral("GeometrySync"));
+    }
+
+protected:
+    void updatePolish() override
+    {
+        Widget_quick::applyPendingGeometries();
+    }
+};
+
+}
+
+static QHash<QQuickWindow *, QPointer<GeometrySync>> s_geometrySyncs;
+
+static void scheduleGeometrySync(QQuickWindow *window)
+{
+    QPointer<GeometrySync> &sync = s_geometrySyncs[window];
+    if (!sync)
+        sync = new GeometrySync(window);
+
+    sync->polish();
+}
+
 Widget_quick::~Widget_quick()
 {
 }
@@ -27,16 +79,50 @@ QSize Widget_quick::minSize() const
 
 QRect Widget_quick::geometry() const
 {
+    auto it = s_pendingGeometries.constFind(m_thisWidget);
+    if (it != s_pendingGeometries.cend() && it->item)
+        return it->geometry;
+
     return QRect(m_thisWidget->x(), m_thisWidget->y(),
                  m_thisWidget->width(), m_thisWidget->height());
 }
 
 void Widget_quick::setGeometry(QRect rect)
 {
+    QQuickWindow *window = m_thisWidget->window();
+    if (window && (Config::self().flags() & Config::Flag::BatchGeometryUpdates)) {
+        // Only the last geometry of this frame reaches the QML bindings
+        s_pendingGeometries.insert(m_thisWidget, { m_thisWidget, rect });
+        scheduleGeometrySync(window);
+        return;
+    }
+
+    s_pendingGeometries.remove(m_thisWidget);
     m_thisWidget->setPosition(rect.topLeft());
     m_thisWidget->setSize(rect.size());
 }
 
+/** static */
+void Widget_quick::applyPendingGeometries()
+{
+    // Applying can trigger bindings that schedule new geometries, those go to the next frame
+    const QHash<QQuickItem *, PendingGeometry> pending = s_pendingGeometries;
+    s_pendingGeometries.clear();
+
+    for (const PendingGeometry &p : pending) {
+        if (p.item) {
+            p.item->setPosition(p.geometry.topLeft());
+            p.item->setSize(p.geometry.size());
+        }
+    }
+}
+
+/** static */
+bool Widget_quick::hasPendingGeometries()
+{
+    return !s_pendingGeometries.isEmpty();
+}
+
 void Widget_quick::setParent(Widget *parent)
 {
     if (!parent) {
@@ -103,16 +189,34 @@ void Widget_quick::move(int x, int y)
 
 void Widget_quick::setSize(int width, int height)
 {
+    if (s_pendingGeometries.contains(m_thisWidget)) {
+        // Don't let the pending geometry overwrite this later
+        QRect geo = geometry();
+        geo.setSize(QSize(width, height));
+        setGeometry(geo);
+        return;
+    }
+
     m_thisWidget->setSize(QSize(width, height));
 }
 
 void Widget_quick::setWidth(int width)
 {
+    if (s_pendingGeometries.contains(m_thisWidget)) {
+        setSize(width, geometry().height());
+        return;
+    }
+
     m_thisWidget->setWidth(width);
 }
 
 void Widget_quick::setHeight(int height)
 {
+    if (s_pendingGeometries.contains(m_thisWidget)) {
+        setSize(geometry().width(), height);
+        return;
+    }
+
     m_thisWidget->setHeight(height);
 }
 
@@ -121,6 +225,16 @@ void Widget_quick::update()
     m_thisWidget->update();
 }
 
+/** static */
+QQmlComponent *Widget_quick::component(QQmlEngine *engine, const QString &filename)
+{
+    QPointer<QQmlComponent> &component = s_components[ComponentKey(engine, filename)];
+    if (!component)
+        component = new QQmlComponent(engine, filename, engine);
+
+    return component;
+}
+
 QQuickItem *Widget_quick::createQQuickItem(const QString &filename, QQuickItem *parent) const
 {
     auto p = parent;
@@ -135,10 +249,10 @@ QQuickItem *Widget_quick::createQQuickItem(const QString &filename, QQuickItem *
         return nullptr;
     }
 
-    QQmlComponent component(engine, filename);
-    auto qquickitem = qobject_cast<QQuickItem*>(component.create());
+    QQmlComponent *component = Widget_quick::component(engine, filename);
+    auto qquickitem = qobject_cast<QQuickItem*>(component->create());
     if (!qquickitem) {
-        qWarning() << Q_FUNC_INFO << component.errorString();
+        qWarning() << Q_FUNC_INFO << component->errorString();
         return nullptr;
     }
 
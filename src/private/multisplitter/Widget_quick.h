@@ -17,6 +17,8 @@
 
 QT_BEGIN_NAMESPACE
 class QQuickItem;
+class QQmlComponent;
+class QQmlEngine;
 QT_END_NAMESPACE
 
 ///@file
@@ -57,6 +59,17 @@ public:
 
     static QSize widgetMinSize(const QWidget *w);
 
+    ///@brief Returns the component for @p filename, compiled once per engine and then reused
+    ///The component is owned by @p engine.
+    static QQmlComponent *component(QQmlEngine *engine, const QString &filename);
+
+    ///@brief Applies the geometries accumulated with Config::Flag::BatchGeometryUpdates now,
+    ///instead of waiting for the next frame
+    static void applyPendingGeometries();
+
+    ///@brief returns whether there's geometries waiting for the next frame
+    static bool hasPendingGeometries();
+
 protected:
     QQuickItem *createQQuickItem(const QString &filename, QQuickItem *parent) const;
 
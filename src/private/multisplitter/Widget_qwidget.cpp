@@ -27,14 +27,36 @@ QSize Widget_qwidget::sizeHint() const
 
 QSize Widget_qwidget::minSize() const
 {
-    return widgetMinSize(m_thisWidget);
+    // minimumSizeHint() can be expensive for deep layouts, so cache it until invalidateSizeConstraints()
+    if (!m_cachedMinSize.isValid()) {
+        countSizeConstraintsComputation();
+        m_cachedMinSize = widgetMinSize(m_thisWidget);
+    }
+
+    return m_cachedMinSize;
 }
 
 QSize Widget_qwidget::maxSizeHint() const
+{
+    if (!m_cachedMaxSizeHint.isValid()) {
+        countSizeConstraintsComputation();
+        m_cachedMaxSizeHint = computeMaxSizeHint();
+    }
+
+    return m_cachedMaxSizeHint;
+}
+
+QSize Widget_qwidget::computeMaxSizeHint() const
 {
     return widgetMaxSize(m_thisWidget);
 }
 
+void Widget_qwidget::invalidateSizeConstraints()
+{
+    m_cachedMinSize = QSize();
+    m_cachedMaxSizeHint = QSize();
+}
+
 QRect Widget_qwidget::geometry() const
 {
     return m_thisWidget->geometry();
@@ -55,9 +55,16 @@ public:
     void setWidth(int width) override;
     void setHeight(int height) override;
     void update() override;
+    void invalidateSizeConstraints() override;
+
+protected:
+    ///@brief Computes the value that maxSizeHint() caches. Reimplement this instead of maxSizeHint()
+    virtual QSize computeMaxSizeHint() const;
 
 private:
     QWidget *const m_thisWidget;
+    mutable QSize m_cachedMinSize;
+    mutable QSize m_cachedMaxSizeHint;
     Q_DISABLE_COPY(Widget_qwidget)
 };
 
@@ -14,8 +14,13 @@
 #include "Widget_qwidget.h"
 #include "MultiSplitterConfig.h"
 #include "Separator_qwidget.h"
+#include "Tracing_p.h"
 
 #include <QPainter>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
 #include <QtTest/QtTest>
 
 #include <memory.h>
@@ -117,6 +122,24 @@ static void fatalWarningsMessageHandler(QtMsgType t, const QMessageLogContext &c
     }
 }
 
+// Sets Config flags for the duration of a test, restoring the original ones even if it fails
+struct SetConfigFlags
+{
+    explicit SetConfigFlags(Config::Flags flags)
+        : m_originalFlags(Config::self().flags())
+    {
+        Config::self().setFlags(flags);
+    }
+
+    ~SetConfigFlags()
+    {
+        Config::self().setFlags(m_originalFlags);
+    }
+
+    const Config::Flags m_originalFlags;
+    Q_DISABLE_COPY(SetConfigFlags)
+};
+
 class TestMultiSplitter : public QObject
 {
     Q_OBJECT
@@ -172,6 +195,12 @@ private Q_SLOTS:
     void tst_misc3();
     void tst_containerGetsHidden();
     void tst_minSizeChanges();
+    void tst_coalescedMinSizeChanges();
+    void tst_solvedGeometryCache();
+    void tst_solvedGeometryCacheRoundTrip();
+#ifdef KDDOCKWIDGETS_TRACING
+    void tst_tracing();
+#endif
     void tst_numSeparators();
     void tst_separatorMinMax();
     void tst_separatorRecreatedOnParentChange();
@@ -1142,6 +1171,201 @@ void TestMultiSplitter::tst_minSizeChanges()
     QVERIFY(serializeDeserializeTest(root));
 }
 
+void TestMultiSplitter::tst_coalescedMinSizeChanges()
+{
+    // Tests that with Config::Flag::CoalesceSizeConstraints a burst of min size changes is
+    // only applied once, in the next event loop iteration
+    SetConfigFlags flags(Config::self().flags() | Config::Flag::CoalesceSizeConstraints);
+
+    auto root = createRoot();
+    Item *item1 = createItem();
+    Item *item2 = createItem();
+    Item *item3 = createItem();
+    root->insertItem(item1, Item::Location_OnLeft);
+    root->insertItem(item2, Item::Location_OnRight);
+    item2->insertItem(item3, Item::Location_OnBottom);
+    root->setSize_recursive(QSize(400, 400));
+    QVERIFY(root->checkSanity());
+
+    int numRootMinSizeChanges = 0;
+    connect(root.get(), &Item::minSizeChanged, this, [&numRootMinSizeChanges] {
+        numRootMinSizeChanges++;
+    });
+    int numItem1MinSizeChanges = 0;
+    connect(item1, &Item::minSizeChanged, this, [&numItem1MinSizeChanges] {
+        numItem1MinSizeChanges++;
+    });
+    int numItem3MinSizeChanges = 0;
+    connect(item3, &Item::minSizeChanged, this, [&numItem3MinSizeChanges] {
+        numItem3MinSizeChanges++;
+    });
+
+    const QSize originalMinSize1 = item1->minSize();
+    auto w1 = static_cast<MyGuestWidget*>(item1->guestAsQObject());
+    auto w3 = static_cast<MyGuestWidget*>(item3->guestAsQObject());
+    w1->setMinSize(QSize(300, 300));
+    w1->setMinSize(QSize(350, 350));
+    w1->setMinSize(QSize(400, 400));
+    w3->setMinSize(QSize(300, 300));
+    QCOMPARE(item1->minSize(), originalMinSize1); // Not applied yet
+
+    QTRY_COMPARE(item1->minSize(), QSize(400, 400));
+    QCOMPARE(item3->minSize(), QSize(300, 300));
+    QCOMPARE(numRootMinSizeChanges, 1);
+    QCOMPARE(numItem1MinSizeChanges, 1); // Leaves are notified too, once per batch
+    QCOMPARE(numItem3MinSizeChanges, 1);
+    QVERIFY(root->checkSanity());
+    QVERIFY(item1->width() >= 400);
+    QVERIFY(item3->height() >= 300);
+    QVERIFY(serializeDeserializeTest(root));
+}
+
+void TestMultiSplitter::tst_solvedGeometryCache()
+{
+    // Tests that resizing a layout identical to an already solved one reuses its geometries
+    Config::self().setSolvedGeometryCacheSize(2);
+    ItemContainer::clearSolvedGeometryCache();
+
+    auto createLayout = [] {
+        auto root = createRoot();
+        Item *item1 = createItem(QSize(100, 100));
+        Item *item2 = createItem();
+        Item *item3 = createItem();
+        root->insertItem(item1, Item::Location_OnLeft);
+        root->insertItem(item2, Item::Location_OnRight);
+        item2->insertItem(item3, Item::Location_OnBottom);
+        return root;
+    };
+
+    auto root1 = createLayout();
+    auto root2 = createLayout();
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(0));
+
+    root1->setSize_recursive(QSize(800, 600));
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(0));
+    const qint64 misses = ItemContainer::solvedGeometryCacheMisses();
+    QVERIFY(misses > 0);
+
+    root2->setSize_recursive(QSize(800, 600));
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(1));
+    QCOMPARE(ItemContainer::solvedGeometryCacheMisses(), misses);
+    QVERIFY(root2->checkSanity());
+
+    const Item::List items1 = root1->items_recursive();
+    const Item::List items2 = root2->items_recursive();
+    QCOMPARE(items1.size(), items2.size());
+    for (int i = 0; i < items1.size(); ++i)
+        QCOMPARE(items1.at(i)->geometry(), items2.at(i)->geometry());
+    QCOMPARE(root1->separators_recursive().size(), root2->separators_recursive().size());
+    QVERIFY(serializeDeserializeTest(root2));
+
+    // Different constraints are a different layout
+    auto w3 = static_cast<MyGuestWidget*>(items2.last()->guestAsQObject());
+    w3->setMinSize(QSize(300, 300));
+    root2->setSize_recursive(QSize(900, 700));
+    root1->setSize_recursive(QSize(900, 700));
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(1));
+    QVERIFY(root1->checkSanity());
+    QVERIFY(root2->checkSanity());
+
+    Config::self().setSolvedGeometryCacheSize(0);
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(0));
+    QCOMPARE(ItemContainer::solvedGeometryCacheMisses(), qint64(0));
+}
+
+void TestMultiSplitter::tst_solvedGeometryCacheRoundTrip()
+{
+    // Tests that a root going back and forth between two sizes, like a window being maximized and
+    // restored, reuses its previous solves
+    Config::self().setSolvedGeometryCacheSize(4);
+    ItemContainer::clearSolvedGeometryCache();
+
+    auto root = createRoot();
+    Item *item1 = createItem(QSize(100, 100));
+    Item *item2 = createItem();
+    Item *item3 = createItem();
+    root->insertItem(item1, Item::Location_OnLeft);
+    root->insertItem(item2, Item::Location_OnRight);
+    item2->insertItem(item3, Item::Location_OnBottom);
+
+    auto geometries = [&root] {
+        QVector<QRect> result;
+        const Item::List items = root->items_recursive();
+        for (Item *item : items)
+            result.push_back(item->geometry());
+        return result;
+    };
+
+    const QSize sizeA(800, 600);
+    const QSize sizeB(1600, 1000);
+
+    root->setSize_recursive(sizeA);
+    const QVector<QRect> geometriesA = geometries();
+    root->setSize_recursive(sizeB);
+    const QVector<QRect> geometriesB = geometries();
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(0));
+    const qint64 misses = ItemContainer::solvedGeometryCacheMisses();
+
+    root->setSize_recursive(sizeA);
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(1));
+    QCOMPARE(geometries(), geometriesA);
+    QVERIFY(root->checkSanity());
+
+    root->setSize_recursive(sizeB);
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(2));
+    QCOMPARE(geometries(), geometriesB);
+    QVERIFY(root->checkSanity());
+
+    root->setSize_recursive(sizeA);
+    QCOMPARE(ItemContainer::solvedGeometryCacheHits(), qint64(3));
+    QCOMPARE(ItemContainer::solvedGeometryCacheMisses(), misses);
+    QCOMPARE(geometries(), geometriesA);
+    QVERIFY(serializeDeserializeTest(root));
+
+    Config::self().setSolvedGeometryCacheSize(0);
+}
+
+#ifdef KDDOCKWIDGETS_TRACING
+void TestMultiSplitter::tst_tracing()
+{
+    // Tests that layout operations are recorded as Chrome trace events
+    QTemporaryDir dir;
+    const QString filename = dir.filePath(QStringLiteral("trace.json"));
+    Tracer::self().start(filename);
+    QVERIFY(Tracer::isRecording());
+
+    auto root = createRoot();
+    Item *item1 = createItem();
+    Item *item2 = createItem();
+    root->insertItem(item1, Item::Location_OnLeft);
+    root->insertItem(item2, Item::Location_OnRight);
+    root->setSize_recursive(QSize(800, 600));
+    root->removeItem(item2);
+    QVERIFY(Tracer::self().eventCount() >= 4);
+
+    QVERIFY(Tracer::self().stop());
+    QVERIFY(!Tracer::isRecording());
+
+    QFile f(filename);
+    QVERIFY(f.open(QIODevice::ReadOnly));
+    const QJsonArray events = QJsonDocument::fromJson(f.readAll()).object().value(QStringLiteral("traceEvents")).toArray();
+    QStringList names;
+    for (const QJsonValue &event : events) {
+        QCOMPARE(event.toObject().value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+        names << event.toObject().value(QStringLiteral("name")).toString();
+    }
+
+    QVERIFY(names.contains(QStringLiteral("ItemContainer::insertItem")));
+    QVERIFY(names.contains(QStringLiteral("ItemContainer::setSize_recursive")));
+    QVERIFY(names.contains(QStringLiteral("ItemContainer::removeItem")));
+
+    // Not recording anymore
+    const int count = Tracer::self().eventCount();
+    root->setSize_recursive(QSize(900, 600));
+    QCOMPARE(Tracer::self().eventCount(), count);
+}
+#endif
+
 void TestMultiSplitter::tst_numSeparators()
 {
     auto root = createRoot();
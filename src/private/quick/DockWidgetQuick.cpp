@@ -38,6 +38,7 @@ public:
 
     DockWidgetBase *const q;
     QQuickItem *const m_visualItem;
+    bool m_isContentReady = true;
 };
 
 DockWidgetQuick::DockWidgetQuick(const QString &name, Options options)
@@ -53,6 +54,26 @@ DockWidgetQuick::~DockWidgetQuick()
 
 void DockWidgetQuick::setWidget(const QString &qmlFilename)
 {
+    if (Config::self().flags() & Config::Flag_AsyncQmlIncubation) {
+        // The empty adapter is laid out now, the guest then just fills it
+        auto adapter = new QWidgetAdapter(this);
+        QWidgetAdapter::makeItemFillParent(adapter);
+        d->m_isContentReady = false;
+        DockWidgetBase::setWidget(adapter);
+
+        createItemAsync(Config::self().qmlEngine(), qmlFilename, adapter, [this, adapter] (QQuickItem *guest) {
+            if (guest) {
+                guest->setParentItem(adapter);
+                guest->setParent(adapter);
+            }
+
+            d->m_isContentReady = true;
+            Q_EMIT contentReady();
+        });
+
+        return;
+    }
+
     QQuickItem *guest = createItem(Config::self().qmlEngine(), qmlFilename);
     if (!guest)
         return;
@@ -65,6 +86,11 @@ void DockWidgetQuick::setWidget(const QString &qmlFilename)
     DockWidgetBase::setWidget(adapter);
 }
 
+bool DockWidgetQuick::isContentReady() const
+{
+    return d->m_isContentReady;
+}
+
 bool DockWidgetQuick::event(QEvent *e)
 {
     if (e->type() == QEvent::ParentChange) {
@@ -35,6 +35,7 @@ namespace KDDockWidgets {
 class DOCKS_EXPORT DockWidgetQuick : public DockWidgetBase
 {
     Q_OBJECT
+    Q_PROPERTY(bool isContentReady READ isContentReady NOTIFY contentReady)
 public:
     /**
      * @brief constructs a new DockWidget
@@ -52,8 +53,19 @@ public:
 
     /// Sets the DockWidget's guest item
     /// Similar to DockWidgetBase::setWidget(QQuickItem*)
+    /// With Config::Flag_AsyncQmlIncubation the item is created over the next frames, the dock
+    /// widget is laid out and shown right away and contentReady() is emitted once the item exists.
     void setWidget(const QString &qmlFilename);
 
+    ///@brief returns whether the item passed to setWidget(const QString &) was already created.
+    ///Only false while it's being incubated, see Config::Flag_AsyncQmlIncubation
+    bool isContentReady() const;
+
+Q_SIGNALS:
+    ///@brief emitted when the asynchronously incubated guest item is created and parented
+    ///Also emitted if creating it failed, in which case the dock widget stays empty.
+    void contentReady();
+
 protected:
     bool event(QEvent *e) override;
 
@@ -30,21 +30,35 @@ FrameQuick::FrameQuick(QWidgetAdapter *parent, FrameOptions options)
     connect(m_dockWidgetModel, &DockWidgetModel::countChanged,
             this, &FrameQuick::onDockWidgetCountChanged);
 
-    auto component = new QQmlComponent(Config::self().qmlEngine(),
-                                       QUrl(QStringLiteral("qrc:/kddockwidgets/private/quick/qml/Frame.qml")));
-
-    auto visualItem = static_cast<QQuickItem*>(component->create());
+    const QString filename = QStringLiteral("qrc:/kddockwidgets/private/quick/qml/Frame.qml");
+    if (Config::self().flags() & Config::Flag_AsyncQmlIncubation) {
+        // The frame is laid out right away, its dock widgets are parented to it until the chrome exists
+        createItemAsync(Config::self().qmlEngine(), filename, this, [this] (QQuickItem *visualItem) {
+            setVisualItem(visualItem);
+        });
+    } else {
+        setVisualItem(createItem(Config::self().qmlEngine(), filename));
+    }
+}
 
+void FrameQuick::setVisualItem(QQuickItem *visualItem)
+{
     if (!visualItem) {
-        qWarning() << Q_FUNC_INFO << "Failed to create item" << component->errorString();
+        qWarning() << Q_FUNC_INFO << "Failed to create item";
         return;
     }
 
+    // Frame.qml calls setStackLayout() as soon as it knows frameCpp
     visualItem->setProperty("frameCpp", QVariant::fromValue(this));
     visualItem->setParentItem(this);
     visualItem->setParent(this);
 }
 
+QQuickItem *FrameQuick::dockWidgetParent()
+{
+    return m_stackLayout ? m_stackLayout : this;
+}
+
 DockWidgetModel *FrameQuick::dockWidgetModel() const
 {
     return m_dockWidgetModel;
@@ -92,10 +106,10 @@ void FrameQuick::setCurrentDockWidget_impl(DockWidgetBase *dw)
 void FrameQuick::insertDockWidget_impl(DockWidgetBase *dw, int index)
 {
     if (m_dockWidgetModel->insert(dw, index)) {
-        dw->setParent(m_stackLayout);
+        dw->setParent(dockWidgetParent());
 
         QMetaObject::Connection conn = connect(dw, &DockWidgetBase::parentChanged, this, [dw, this] {
-            if (dw->parent() != m_stackLayout)
+            if (dw->parent() != dockWidgetParent())
                 removeWidget_impl(dw);
         });
 
@@ -129,6 +143,10 @@ void FrameQuick::setStackLayout(QQuickItem *stackLayout)
     }
 
     m_stackLayout = stackLayout;
+
+    // Dock widgets added while the chrome was being incubated
+    for (int i = 0, count = m_dockWidgetModel->count(); i < count; ++i)
+        m_dockWidgetModel->dockWidgetAt(i)->setParent(m_stackLayout);
 }
 
 DockWidgetModel::DockWidgetModel(QObject *parent)
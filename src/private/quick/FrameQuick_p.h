@@ -50,6 +50,11 @@ protected:
 Q_SIGNALS:
     void tabTitlesChanged();
 private:
+    void setVisualItem(QQuickItem *);
+
+    ///@brief returns the stack layout, or the frame itself while Frame.qml is being incubated
+    QQuickItem *dockWidgetParent();
+
     QQuickItem *m_stackLayout = nullptr;
     DockWidgetBase *m_currentDockWidget = nullptr;
     DockWidgetModel *const m_dockWidgetModel;
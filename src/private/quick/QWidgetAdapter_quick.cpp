@@ -20,15 +20,49 @@
 
 #include "QWidgetAdapter.h"
 #include "FloatingWindow_p.h"
+#include "multisplitter/Widget_quick.h"
 
 #include <QResizeEvent>
 #include <QMouseEvent>
 #include <QQmlComponent>
+#include <QQmlIncubator>
 #include <QQuickItem>
 #include <QQmlEngine>
 
 using namespace KDDockWidgets;
 
+namespace {
+
+///@brief Incubates one item. Deleted when done, or canceled when its owner is deleted
+class ItemIncubator : public QObject, public QQmlIncubator
+{
+public:
+    ItemIncubator(QObject *owner, const std::function<void(QQuickItem *)> &onReady)
+        : QObject(owner)
+        , QQmlIncubator(QQmlIncubator::Asynchronous)
+        , m_onReady(onReady)
+    {
+    }
+
+protected:
+    void statusChanged(Status status) override
+    {
+        if (status == Ready) {
+            m_onReady(qobject_cast<QQuickItem*>(object()));
+            deleteLater();
+        } else if (status == Error) {
+            qWarning() << Q_FUNC_INFO << errors();
+            m_onReady(nullptr);
+            deleteLater();
+        }
+    }
+
+private:
+    const std::function<void(QQuickItem *)> m_onReady;
+};
+
+}
+
 QWidgetAdapter::QWidgetAdapter(QQuickItem *parent, Qt::WindowFlags flags)
     : QQuickItem(parent)
     , m_requestedWindowFlags(flags)
@@ -311,16 +345,31 @@ Qt::WindowFlags QWidgetAdapter::windowFlags() const
 /** static */
 QQuickItem *QWidgetAdapter::createItem(QQmlEngine *engine, const QString &filename)
 {
-    QQmlComponent component(engine, filename);
-    QObject *obj = component.create();
+    QQmlComponent *component = Layouting::Widget_quick::component(engine, filename);
+    QObject *obj = component->create();
     if (!obj) {
-        qWarning() << Q_FUNC_INFO << component.errorString();
+        qWarning() << Q_FUNC_INFO << component->errorString();
         return nullptr;
     }
 
     return qobject_cast<QQuickItem*>(obj);
 }
 
+/** static */
+void QWidgetAdapter::createItemAsync(QQmlEngine *engine, const QString &filename, QObject *owner,
+                                     const std::function<void(QQuickItem *)> &onReady)
+{
+    QQmlComponent *component = Layouting::Widget_quick::component(engine, filename);
+    if (!component->isReady()) {
+        // Errors, or still loading from the network. Nothing to incubate.
+        onReady(createItem(engine, filename));
+        return;
+    }
+
+    // Without an incubation controller, which QQuickWindow installs, this completes synchronously
+    component->create(*new ItemIncubator(owner, onReady));
+}
+
 void QWidgetAdapter::makeItemFillParent(QQuickItem *item)
 {
     // This is equivalent to "anchors.fill: parent
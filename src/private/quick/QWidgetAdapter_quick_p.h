@@ -30,6 +30,8 @@
 #include <QSizePolicy>
 #include <QQuickWindow>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 class QWindow;
 class QQmlEngine;
@@ -143,6 +145,12 @@ public:
     void setWindowOpacity(qreal);
 
     static QQuickItem *createItem(QQmlEngine *, const QString &filename);
+
+    ///@brief Like createItem(), but the item is incubated asynchronously with QQmlIncubator, over
+    ///the next frames. @p onReady is called with the item, or with nullptr on error. If @p owner
+    ///is deleted before that the incubation is canceled and @p onReady isn't called.
+    static void createItemAsync(QQmlEngine *, const QString &filename, QObject *owner,
+                                const std::function<void(QQuickItem *)> &onReady);
     static void makeItemFillParent(QQuickItem *item);
 Q_SIGNALS:
     void parentChanged();
@@ -44,7 +44,8 @@ DockWidget::DockWidget(const QString &name, Options options)
     , d(new Private(this))
 {
     connect(this, &DockWidgetBase::widgetChanged, this, [this] (QWidget *w) {
-        d->layout->addWidget(w);
+        if (w) // nullptr when hibernated, the guest is removed from the layout when deleted
+            d->layout->addWidget(w);
     });
 }
 
@@ -41,6 +41,7 @@ public:
     void invalidate() override
     {
         QVBoxLayout::invalidate();
+        m_frameWidget->invalidateSizeConstraints();
         Q_EMIT m_frameWidget->layoutInvalidated();
     }
 
@@ -77,7 +78,7 @@ void FrameWidget::paintEvent(QPaintEvent *)
     }
 }
 
-QSize FrameWidget::maxSizeHint() const
+QSize FrameWidget::computeMaxSizeHint() const
 {
     // waste due to QTabWidget margins, tabbar etc.
     const QSize waste = minSize() - dockWidgetsMinSize();
@@ -38,7 +38,7 @@ public:
 
 protected:
     void paintEvent(QPaintEvent *) override;
-    QSize maxSizeHint() const override;
+    QSize computeMaxSizeHint() const override;
     void detachTab_impl(DockWidgetBase *) override;
     int indexOfDockWidget_impl(DockWidgetBase *) override;
     void setCurrentDockWidget_impl(DockWidgetBase *) override;
@@ -84,14 +84,15 @@ std::unique_ptr<WindowBeingDragged> TabBar::makeWindow()
     if (!dock)
         return {};
 
-    FloatingWindow *floatingWindow = detachTab(dock);
+    // With outline dragging the window is only shown if it doesn't get dropped
+    FloatingWindow *floatingWindow = detachTab(dock, /*show=*/ !KDDockWidgets::usesOutlineDragging());
 
     auto draggable = KDDockWidgets::usesNativeTitleBar() ? static_cast<Draggable*>(floatingWindow)
                                                          : static_cast<Draggable*>(this);
     return std::unique_ptr<WindowBeingDragged>(new WindowBeingDragged(floatingWindow, draggable));
 }
 
-FloatingWindow * TabBar::detachTab(DockWidgetBase *dockWidget)
+FloatingWindow * TabBar::detachTab(DockWidgetBase *dockWidget, bool show)
 {
     QRect r = dockWidget->geometry();
     m_tabWidget->removeDockWidget(dockWidget);
@@ -105,7 +106,8 @@ FloatingWindow * TabBar::detachTab(DockWidgetBase *dockWidget)
     auto floatingWindow = Config::self().frameworkWidgetFactory()->createFloatingWindow(newFrame);
     r.moveTopLeft(globalPoint);
     floatingWindow->setSuggestedGeometry(r);
-    floatingWindow->show();
+    if (show)
+        floatingWindow->show();
 
     return floatingWindow;
 }
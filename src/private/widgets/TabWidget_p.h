@@ -62,9 +62,10 @@ public:
      * @brief detaches a dock widget and shows it as a floating dock widget
      * The dock widget is morphed into a FloatingWindow for convenience.
      * @param dockWidget the dock widget to detach
+     * @param show if false the FloatingWindow is left hidden, so no native window is created yet
      * @returns the created FloatingWindow
      */
-    FloatingWindow *detachTab(DockWidgetBase *dockWidget);
+    FloatingWindow *detachTab(DockWidgetBase *dockWidget, bool show = true);
 
     void onMousePress(QPoint localPos);
 
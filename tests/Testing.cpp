@@ -11,6 +11,7 @@
 
 #include "Testing.h"
 #include "DockRegistry_p.h"
+#include "FloatingWindow_p.h"
 
 #include <QApplication>
 #include <QtTest>
@@ -121,6 +122,24 @@ bool Testing::waitForResize(QWidgetOrQuick *w, int timeout)
     return waitForEvent(w, QEvent::Resize, timeout);
 }
 
+bool Testing::deleteAll()
+{
+    for (MainWindowBase *mw : DockRegistry::self()->mainwindows())
+        delete mw;
+
+    for (FloatingWindow *fw : DockRegistry::self()->nestedwindows())
+        delete fw;
+
+    for (DockWidgetBase *dw : DockRegistry::self()->dockwidgets())
+        delete dw;
+
+    // Frames and tab widgets use deleteLater(), flush them so the caller starts clean
+    // without having to wait for the event loop
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    return DockRegistry::self()->isEmpty();
+}
+
 HostedWidget::~HostedWidget() {}
 
 void Testing::installFatalMessageHandler()
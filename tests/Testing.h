@@ -106,6 +106,10 @@ namespace Testing {
     bool waitForDeleted(QObject *o, int timeout = 2000);
     bool waitForResize(QWidgetOrQuick *w, int timeout = 2000);
 
+    ///@brief Deletes all main windows, floating windows and dock widgets, and flushes the deferred
+    ///deletions of their frames. Returns whether the registry ended up empty.
+    bool deleteAll();
+
     class HostedWidget : public QWidgetOrQuick
     {
     public:
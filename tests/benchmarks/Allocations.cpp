@@ -0,0 +1,246 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Allocations.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+# include <malloc.h>
+#endif
+
+using namespace KDDockWidgets;
+
+// Constant initialized, as allocations happen before any dynamic initialization
+static std::atomic<qint64> s_numAllocations(0);
+static std::atomic<qint64> s_numAllocatedBytes(0);
+static std::atomic<qint64> s_numLiveAllocations(0);
+static std::atomic<qint64> s_numLiveBytes(0);
+
+static void countAllocation(std::size_t requestedSize)
+{
+    s_numAllocations.fetch_add(1, std::memory_order_relaxed);
+    s_numAllocatedBytes.fetch_add(qint64(requestedSize), std::memory_order_relaxed);
+}
+
+static void countLive(qint64 numAllocations, qint64 numBytes)
+{
+    s_numLiveAllocations.fetch_add(numAllocations, std::memory_order_relaxed);
+    s_numLiveBytes.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+qint64 Allocations::numAllocations()
+{
+    return s_numAllocations.load(std::memory_order_relaxed);
+}
+
+qint64 Allocations::numAllocatedBytes()
+{
+    return s_numAllocatedBytes.load(std::memory_order_relaxed);
+}
+
+qint64 Allocations::numLiveAllocations()
+{
+    return s_numLiveAllocations.load(std::memory_order_relaxed);
+}
+
+qint64 Allocations::numLiveBytes()
+{
+    return s_numLiveBytes.load(std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+
+// Live bytes use malloc_usable_size(), as free() isn't told the size
+
+static void *countedResult(void *ptr, std::size_t requestedSize)
+{
+    if (ptr) {
+        countAllocation(requestedSize);
+        countLive(1, qint64(malloc_usable_size(ptr)));
+    }
+    return ptr;
+}
+
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *ptr, std::size_t size);
+void *__libc_memalign(std::size_t alignment, std::size_t size);
+void *__libc_valloc(std::size_t size);
+void *__libc_pvalloc(std::size_t size);
+void __libc_free(void *ptr);
+
+void *malloc(std::size_t size) noexcept
+{
+    return countedResult(__libc_malloc(size), size);
+}
+
+void *calloc(std::size_t count, std::size_t size) noexcept
+{
+    return countedResult(__libc_calloc(count, size), count * size);
+}
+
+void *realloc(void *ptr, std::size_t size) noexcept
+{
+    if (!ptr)
+        return malloc(size);
+
+    const qint64 oldSize = qint64(malloc_usable_size(ptr));
+    void *result = __libc_realloc(ptr, size);
+    if (result) {
+        countAllocation(size);
+        countLive(0, qint64(malloc_usable_size(result)) - oldSize);
+    } else if (size == 0) {
+        // Freed ptr
+        countLive(-1, -oldSize);
+    }
+
+    return result;
+}
+
+void *reallocarray(void *ptr, std::size_t count, std::size_t size) noexcept
+{
+    if (size && count > std::size_t(-1) / size) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+
+    return realloc(ptr, count * size);
+}
+
+void *memalign(std::size_t alignment, std::size_t size) noexcept
+{
+    return countedResult(__libc_memalign(alignment, size), size);
+}
+
+void *aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+{
+    return countedResult(__libc_memalign(alignment, size), size);
+}
+
+int posix_memalign(void **ptr, std::size_t alignment, std::size_t size) noexcept
+{
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        return EINVAL;
+
+    void *result = countedResult(__libc_memalign(alignment, size), size);
+    if (!result)
+        return ENOMEM;
+
+    *ptr = result;
+    return 0;
+}
+
+void *valloc(std::size_t size) noexcept
+{
+    return countedResult(__libc_valloc(size), size);
+}
+
+void *pvalloc(std::size_t size) noexcept
+{
+    return countedResult(__libc_pvalloc(size), size);
+}
+
+void free(void *ptr) noexcept
+{
+    if (ptr)
+        countLive(-1, -qint64(malloc_usable_size(ptr)));
+    __libc_free(ptr);
+}
+}
+
+#else
+
+// Each allocation is prefixed with its size, so frees can be subtracted. Keeps malloc's alignment.
+static const std::size_t s_headerSize = alignof(std::max_align_t);
+
+static void *countedAlloc(std::size_t size) noexcept
+{
+    auto header = static_cast<std::size_t *>(std::malloc(size + s_headerSize));
+    if (!header)
+        return nullptr;
+
+    *header = size;
+    countAllocation(size);
+    countLive(1, qint64(size));
+    return reinterpret_cast<char *>(header) + s_headerSize;
+}
+
+static void countedFree(void *ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    auto header = reinterpret_cast<std::size_t *>(static_cast<char *>(ptr) - s_headerSize);
+    countLive(-1, -qint64(*header));
+    std::free(header);
+}
+
+void *operator new(std::size_t size)
+{
+    if (void *ptr = countedAlloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    if (void *ptr = countedAlloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAlloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    countedFree(ptr);
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#ifndef KDDOCKWIDGETS_BENCHMARKS_ALLOCATIONS_H
+#define KDDOCKWIDGETS_BENCHMARKS_ALLOCATIONS_H
+
+#include <QtGlobal>
+
+/**
+ * @file
+ * @brief Heap allocation counters shared by the benchmarks
+ *
+ * Linking Allocations.cpp installs the hook. With glibc, malloc() and friends are interposed,
+ * which operator new and Qt's containers both end up calling. Otherwise only operator new is counted.
+ */
+
+namespace KDDockWidgets {
+namespace Allocations {
+
+///@brief Returns the number of allocations since startup
+qint64 numAllocations();
+
+///@brief Returns the bytes requested by all allocations since startup
+qint64 numAllocatedBytes();
+
+///@brief Returns the number of allocations that weren't freed yet
+qint64 numLiveAllocations();
+
+///@brief Returns the bytes held by allocations that weren't freed yet.
+///Includes the allocator's rounding with glibc, so it's comparable to itself only.
+qint64 numLiveBytes();
+
+}
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+// We don't care about performance related checks in the tests
+// clazy:excludeall=ctor-missing-parent-argument,missing-qobject-macro,range-loop,missing-typeinfo,detaching-member,function-args-by-ref,non-pod-global-static,reserve-candidates,qstring-allocations
+
+/**
+ * Measures the latency of each mouse move while dragging a floating window over a main window.
+ * That's DragController's event filter, StateDragging::handleMouseMove(), DropArea::hover() and
+ * the drop indicator update, which are synchronous within the QMouseEvent delivery, plus the
+ * repaint they schedule, flushed by processing the pending events.
+ *
+ * Runs every combination of drop indicator type, number of floating windows and number of frames
+ * in the main window, and prints the p50/p99 latency and the allocations and bytes per move.
+ */
+
+#include "DockWidgetBase.h"
+#include "MainWindowBase.h"
+#include "FloatingWindow_p.h"
+#include "TitleBar_p.h"
+#include "FrameworkWidgetFactory.h"
+#include "Statistics.h"
+#include "Allocations.h"
+#include "../utils.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QPushButton>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::Tests;
+
+struct Scenario {
+    DropIndicatorType indicatorType;
+    int numFloatingWindows;
+    int numFrames;
+};
+
+struct Result {
+    qint64 p50Nsecs = 0;
+    qint64 p99Nsecs = 0;
+    double allocationsPerMove = 0;
+    qint64 maxAllocations = 0;
+    double bytesPerMove = 0;
+    double solverAllocationsPerMove = 0;
+    double hoversPerMove = 0;
+};
+
+static qint64 percentile(QVector<qint64> sorted, double p)
+{
+    if (sorted.isEmpty())
+        return 0;
+
+    std::sort(sorted.begin(), sorted.end());
+    const int index = qMin(sorted.size() - 1, int(sorted.size() * p));
+    return sorted.at(index);
+}
+
+/// Docks @p numFrames dock widgets in a grid of 10 columns, so each move hovers a different frame
+static void populateMainWindow(MainWindowBase *mainWindow, int numFrames)
+{
+    const int numColumns = qMin(10, numFrames);
+    QVector<DockWidgetBase *> columnTops;
+    for (int i = 0; i < numFrames; ++i) {
+        auto dock = createDockWidget(QStringLiteral("docked-%1").arg(i), new QPushButton(QString::number(i)), {}, /*show=*/ false);
+        if (i < numColumns) {
+            mainWindow->addDockWidget(dock, Location_OnRight);
+            columnTops << dock;
+        } else {
+            mainWindow->addDockWidget(dock, Location_OnBottom, columnTops.at(i % numColumns));
+        }
+    }
+}
+
+static Result runScenario(const Scenario &scenario, int numDrags, int numMoves)
+{
+    // The overlay is created with the drop area, so set the type before creating any window
+    DefaultWidgetFactory::s_dropIndicatorType = scenario.indicatorType;
+
+    auto mainWindow = createMainWindow(QSize(1600, 1200), MainWindowOption_None);
+    mainWindow->move(0, 0);
+    populateMainWindow(mainWindow.get(), scenario.numFrames);
+
+    QVector<DockWidgetBase *> floatingDocks;
+    for (int i = 0; i < scenario.numFloatingWindows; ++i) {
+        auto dock = createDockWidget(QStringLiteral("floating-%1").arg(i), new QPushButton(QString::number(i)));
+        // Stack them to the right of the main window, so the drags start outside of it
+        dock->window()->setGeometry(1700 + (i % 10) * 20, 50 + (i / 10) * 20, 400, 400);
+        floatingDocks << dock;
+    }
+
+    QCoreApplication::processEvents();
+
+    const QRect target = mainWindow->geometry().adjusted(20, 20, -20, -20);
+    QVector<qint64> latencies;
+    QVector<qint64> allocations;
+    qint64 numAllocatedBytes = 0;
+    latencies.reserve(numDrags * numMoves);
+    allocations.reserve(numDrags * numMoves);
+    qint64 numSolverAllocations = 0;
+    qint64 numHovers = 0;
+
+    for (int drag = 0; drag < numDrags; ++drag) {
+        // Always drag the top-most one, the others are just there to be hovered and z-ordered
+        FloatingWindow *fw = floatingDocks.last()->floatingWindow();
+        if (!fw) {
+            qWarning() << "Dock widget isn't floating anymore";
+            break;
+        }
+
+        QWidget *titleBar = fw->titleBar();
+        const QPoint start = titleBar->mapToGlobal(QPoint(10, 10));
+        pressOn(start, titleBar);
+
+        // Unmeasured moves, to get past the drag threshold and into the dragging state
+        for (int i = 1; i <= 5; ++i)
+            moveMouseOnce(start + QPoint(-i * 10, 0), titleBar);
+        QCoreApplication::processEvents();
+
+        const Statistics statsBefore = Statistics::snapshot();
+        for (int i = 0; i < numMoves; ++i) {
+            // Golden ratio stride, covers the whole main window without a regular pattern
+            const double fx = std::fmod(i * 0.6180339887, 1.0);
+            const double fy = double(i) / numMoves;
+            const QPoint pos(target.left() + int(fx * target.width()), target.top() + int(fy * target.height()));
+
+            const qint64 allocationsBefore = Allocations::numAllocations();
+            const qint64 bytesBefore = Allocations::numAllocatedBytes();
+            QElapsedTimer timer;
+            timer.start();
+            moveMouseOnce(pos, titleBar);
+            // Flushes the UpdateRequests, so the repaint of the indicators and rubber band is included
+            QCoreApplication::processEvents();
+            latencies << timer.nsecsElapsed();
+            allocations << Allocations::numAllocations() - allocationsBefore;
+            numAllocatedBytes += Allocations::numAllocatedBytes() - bytesBefore;
+        }
+        const Statistics statsAfter = Statistics::snapshot();
+        numSolverAllocations += statsAfter.numSolverAllocations - statsBefore.numSolverAllocations;
+        numHovers += statsAfter.numHovers - statsBefore.numHovers;
+
+        // Release back outside of the main window, so nothing gets docked and the next drag is the same
+        moveMouseOnce(start, titleBar);
+        releaseOn(start, titleBar);
+        QCoreApplication::processEvents();
+    }
+
+    Result result;
+    const int numSamples = latencies.size();
+    if (numSamples > 0) {
+        result.p50Nsecs = percentile(latencies, 0.50);
+        result.p99Nsecs = percentile(latencies, 0.99);
+        qint64 totalAllocations = 0;
+        for (qint64 a : allocations) {
+            totalAllocations += a;
+            result.maxAllocations = qMax(result.maxAllocations, a);
+        }
+        result.allocationsPerMove = double(totalAllocations) / numSamples;
+        result.bytesPerMove = double(numAllocatedBytes) / numSamples;
+        result.solverAllocationsPerMove = double(numSolverAllocations) / numSamples;
+        result.hoversPerMove = double(numHovers) / numSamples;
+    }
+
+    qDeleteAll(floatingDocks);
+    mainWindow.reset();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    return result;
+}
+
+static const char *indicatorTypeStr(DropIndicatorType type)
+{
+    switch (type) {
+    case DropIndicatorType::Classic:
+        return "Classic";
+    case DropIndicatorType::Segmented:
+        return "Segmented";
+    default:
+        return "Other";
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!qpaPassedAsArgument(argc, argv)) {
+        // Use offscreen by default as it's less annoying, doesn't create visible windows
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Drag and drop latency benchmark");
+
+    QCommandLineOption movesOption("moves", QCoreApplication::translate("main", "Mouse moves measured per drag"), "count", "500");
+    parser.addOption(movesOption);
+
+    QCommandLineOption dragsOption("drags", QCoreApplication::translate("main", "Drags per scenario"), "count", "5");
+    parser.addOption(dragsOption);
+
+    parser.addHelpOption();
+    parser.process(app);
+
+    const int numMoves = qMax(1, parser.value(movesOption).toInt());
+    const int numDrags = qMax(1, parser.value(dragsOption).toInt());
+
+    QVector<Scenario> scenarios;
+    for (DropIndicatorType type : { DropIndicatorType::Classic, DropIndicatorType::Segmented }) {
+        for (int numFloatingWindows : { 1, 10, 50 }) {
+            for (int numFrames : { 10, 100 })
+                scenarios.push_back({ type, numFloatingWindows, numFrames });
+        }
+    }
+
+    QTimer::singleShot(0, &app, [&app, scenarios, numDrags, numMoves] {
+        std::cout << std::left << std::setw(12) << "indicators" << std::setw(10) << "floating"
+                  << std::setw(8) << "frames" << std::setw(10) << "p50(us)" << std::setw(10) << "p99(us)"
+                  << std::setw(13) << "allocs/move" << std::setw(16) << "max allocs/move"
+                  << std::setw(13) << "bytes/move"
+                  << std::setw(19) << "solver allocs/move" << "hovers/move\n";
+
+        for (const Scenario &scenario : scenarios) {
+            const Result r = runScenario(scenario, numDrags, numMoves);
+            std::cout << std::left << std::fixed << std::setprecision(1)
+                      << std::setw(12) << indicatorTypeStr(scenario.indicatorType)
+                      << std::setw(10) << scenario.numFloatingWindows
+                      << std::setw(8) << scenario.numFrames
+                      << std::setw(10) << r.p50Nsecs / 1000.0
+                      << std::setw(10) << r.p99Nsecs / 1000.0
+                      << std::setw(13) << r.allocationsPerMove
+                      << std::setw(16) << r.maxAllocations
+                      << std::setw(13) << r.bytesPerMove
+                      << std::setw(19) << r.solverAllocationsPerMove
+                      << r.hoversPerMove << "\n";
+        }
+
+        app.quit();
+    });
+
+    app.setQuitOnLastWindowClosed(false);
+    return app.exec();
+}
@@ -0,0 +1,375 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+// We don't care about performance related checks in the tests
+// clazy:excludeall=ctor-missing-parent-argument,missing-qobject-macro,range-loop,missing-typeinfo,detaching-member,function-args-by-ref,non-pod-global-static,reserve-candidates,qstring-allocations
+
+/**
+ * Memory footprint and leak harness.
+ *
+ * 1. Footprint: the heap cost of a main window, and of a dock widget when hidden, docked, tabbed,
+ *    closed and floating, broken down per type created by the FrameworkWidgetFactory.
+ *    Plus the sizeof() of each class involved.
+ * 2. Leaks: runs the same fuzzer test over and over, fails if the heap doesn't return to the
+ *    baseline after the cycles.
+ *
+ * Heap usage is tracked by the allocation counters in Allocations.h.
+ */
+
+#include "DockWidgetBase.h"
+#include "DockWidget.h"
+#include "MainWindow.h"
+#include "Config.h"
+#include "FrameworkWidgetFactory.h"
+#include "FloatingWindow_p.h"
+#include "Position_p.h"
+#include "private/widgets/FrameWidget_p.h"
+#include "private/widgets/TitleBarWidget_p.h"
+#include "private/widgets/TabWidgetWidget_p.h"
+#include "private/widgets/TabBarWidget_p.h"
+#include "private/widgets/FloatingWindowWidget_p.h"
+#include "private/indicators/ClassicIndicators_p.h"
+#include "private/indicators/SegmentedIndicators_p.h"
+#include "multisplitter/Item_p.h"
+#include "multisplitter/Separator_qwidget.h"
+#include "Allocations.h"
+#include "../fuzzer/Fuzzer.h"
+#include "../utils.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QLabel>
+#include <QTimer>
+#include <QVector>
+
+#include <algorithm>
+#include <iostream>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::Testing;
+
+/**
+ * Attributes the heap allocated by each create*() call to the type it creates, so each step of
+ * measureFootprint() can be broken down. Nested calls, like the title bar a frame creates, are
+ * subtracted from the outer one. Whatever isn't created by the factory, like the layouting Items,
+ * Positions and ItemRefs, is reported as the remainder of the step.
+ */
+class MeasuringWidgetFactory : public DefaultWidgetFactory
+{
+public:
+    struct TypeUsage {
+        const char *type;
+        int count;
+        qint64 bytes;
+    };
+
+    Frame *createFrame(QWidgetOrQuick *parent, FrameOptions options) const override
+    {
+        return measure("Frame", [&] { return DefaultWidgetFactory::createFrame(parent, options); });
+    }
+
+    TitleBar *createTitleBar(Frame *frame) const override
+    {
+        return measure("TitleBar", [&] { return DefaultWidgetFactory::createTitleBar(frame); });
+    }
+
+    TitleBar *createTitleBar(FloatingWindow *floatingWindow) const override
+    {
+        return measure("TitleBar", [&] { return DefaultWidgetFactory::createTitleBar(floatingWindow); });
+    }
+
+    TabBar *createTabBar(TabWidget *parent) const override
+    {
+        return measure("TabBar", [&] { return DefaultWidgetFactory::createTabBar(parent); });
+    }
+
+    TabWidget *createTabWidget(Frame *parent) const override
+    {
+        return measure("TabWidget", [&] { return DefaultWidgetFactory::createTabWidget(parent); });
+    }
+
+    Layouting::Separator *createSeparator(Layouting::Widget *parent) const override
+    {
+        return measure("Separator", [&] { return DefaultWidgetFactory::createSeparator(parent); });
+    }
+
+    FloatingWindow *createFloatingWindow(MainWindowBase *parent) const override
+    {
+        return measure("FloatingWindow", [&] { return DefaultWidgetFactory::createFloatingWindow(parent); });
+    }
+
+    FloatingWindow *createFloatingWindow(Frame *frame, MainWindowBase *parent) const override
+    {
+        return measure("FloatingWindow", [&] { return DefaultWidgetFactory::createFloatingWindow(frame, parent); });
+    }
+
+    DropIndicatorOverlayInterface *createDropIndicatorOverlay(DropArea *dropArea) const override
+    {
+        return measure("Drop indicators", [&] { return DefaultWidgetFactory::createDropIndicatorOverlay(dropArea); });
+    }
+
+    QWidgetOrQuick *createRubberBand(QWidgetOrQuick *parent) const override
+    {
+        return measure("RubberBand", [&] { return DefaultWidgetFactory::createRubberBand(parent); });
+    }
+
+    /// Returns what was created since the last call, and starts over
+    QVector<TypeUsage> takeUsage()
+    {
+        const QVector<TypeUsage> usage = m_usage;
+        m_usage.clear();
+        return usage;
+    }
+
+private:
+    template <typename Func>
+    auto measure(const char *type, Func create) const -> decltype(create())
+    {
+        const qint64 bytesBefore = Allocations::numLiveBytes();
+        m_nestedBytes.push_back(0);
+
+        auto result = create();
+
+        const qint64 bytes = Allocations::numLiveBytes() - bytesBefore;
+        const qint64 nestedBytes = m_nestedBytes.takeLast();
+        if (!m_nestedBytes.isEmpty())
+            m_nestedBytes.last() += bytes;
+
+        auto it = std::find_if(m_usage.begin(), m_usage.end(), [type] (const TypeUsage &u) {
+            return qstrcmp(u.type, type) == 0;
+        });
+        if (it == m_usage.end()) {
+            m_usage.push_back(TypeUsage { type, 0, 0 });
+            it = m_usage.end() - 1;
+        }
+        it->count++;
+        it->bytes += bytes - nestedBytes;
+
+        return result;
+    }
+
+    mutable QVector<qint64> m_nestedBytes;
+    mutable QVector<TypeUsage> m_usage;
+};
+
+static MeasuringWidgetFactory *s_measuringFactory = nullptr;
+
+struct HeapUsage {
+    qint64 bytes = 0;
+    qint64 allocations = 0;
+    QVector<MeasuringWidgetFactory::TypeUsage> created; ///< By the factory, since the previous snapshot
+
+    /// Settles deferred work and deletions first, so they're not counted
+    static HeapUsage current()
+    {
+        QCoreApplication::processEvents();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        HeapUsage usage;
+        usage.bytes = Allocations::numLiveBytes();
+        usage.allocations = Allocations::numLiveAllocations();
+        if (s_measuringFactory)
+            usage.created = s_measuringFactory->takeUsage();
+        return usage;
+    }
+};
+
+/// Prints what the factory created between two consecutive snapshots, and what remains unattributed
+static void printBreakdown(const HeapUsage &before, const HeapUsage &after, int count)
+{
+    qint64 attributedBytes = 0;
+    for (const MeasuringWidgetFactory::TypeUsage &u : after.created) {
+        std::cout << "      " << u.type << " (x" << u.count << "): " << u.bytes / count << " bytes\n";
+        attributedBytes += u.bytes;
+    }
+
+    if (after.created.isEmpty())
+        return;
+
+    std::cout << "      Other (Items, Positions, ItemRefs, ...): "
+              << (after.bytes - before.bytes - attributedBytes) / count << " bytes\n";
+}
+
+static void printDelta(const char *what, const HeapUsage &before, const HeapUsage &after, int count = 1)
+{
+    std::cout << "  " << what << ": " << (after.bytes - before.bytes) / count << " bytes in "
+              << (after.allocations - before.allocations) / count << " allocations\n";
+    printBreakdown(before, after, count);
+}
+
+static void printSizes()
+{
+    std::cout << "sizeof:\n"
+              << "  DockWidget: " << sizeof(DockWidget) << "\n"
+              << "  FrameWidget: " << sizeof(FrameWidget) << "\n"
+              << "  TitleBarWidget: " << sizeof(TitleBarWidget) << "\n"
+              << "  TabWidgetWidget: " << sizeof(TabWidgetWidget) << "\n"
+              << "  TabBarWidget: " << sizeof(TabBarWidget) << "\n"
+              << "  FloatingWindowWidget: " << sizeof(FloatingWindowWidget) << "\n"
+              << "  Layouting::Item: " << sizeof(Layouting::Item) << "\n"
+              << "  Layouting::ItemContainer: " << sizeof(Layouting::ItemContainer) << "\n"
+              << "  Layouting::SeparatorWidget: " << sizeof(Layouting::SeparatorWidget) << "\n"
+              << "  Position: " << sizeof(Position) << "\n"
+              << "  ItemRef: " << sizeof(ItemRef) << "\n"
+              << "  ClassicIndicators: " << sizeof(ClassicIndicators) << "\n"
+              << "  SegmentedIndicators: " << sizeof(SegmentedIndicators) << "\n";
+}
+
+static QVector<DockWidgetBase *> createDockWidgets(const QString &prefix, int num)
+{
+    QVector<DockWidgetBase *> dockWidgets;
+    for (int i = 0; i < num; ++i) {
+        const QString name = QStringLiteral("%1-%2").arg(prefix).arg(i);
+        auto dock = new DockWidget(name);
+        dock->setWidget(new QLabel(name));
+        dockWidgets << dock;
+    }
+
+    return dockWidgets;
+}
+
+static void measureFootprint(int numDockWidgets)
+{
+    printSizes();
+    std::cout << "\nHeap cost, averaged over " << numDockWidgets << " dock widgets:\n";
+
+    s_measuringFactory = new MeasuringWidgetFactory();
+    Config::self().setFrameworkWidgetFactory(s_measuringFactory);
+
+    // Warm up, so Qt's own one-time allocations (style, fonts, ...) don't count
+    Testing::deleteAll();
+    {
+        auto mainWindow = new MainWindow(QStringLiteral("warmup"));
+        mainWindow->show();
+        const QVector<DockWidgetBase *> docks = createDockWidgets(QStringLiteral("warmup"), 2);
+        mainWindow->addDockWidget(docks.at(0), Location_OnLeft);
+        docks.at(0)->addDockWidgetAsTab(docks.at(1));
+        HeapUsage::current();
+        Testing::deleteAll();
+    }
+
+    const HeapUsage baseline = HeapUsage::current();
+
+    auto mainWindow = new MainWindow(QStringLiteral("main"));
+    mainWindow->resize(1600, 1200);
+    mainWindow->show();
+    const HeapUsage withMainWindow = HeapUsage::current();
+    printDelta("MainWindow", baseline, withMainWindow);
+
+    const QVector<DockWidgetBase *> docked = createDockWidgets(QStringLiteral("docked"), numDockWidgets);
+    const HeapUsage withHidden = HeapUsage::current();
+    printDelta("DockWidget, hidden", withMainWindow, withHidden, numDockWidgets);
+
+    for (int i = 0; i < docked.size(); ++i)
+        mainWindow->addDockWidget(docked.at(i), i % 2 ? Location_OnRight : Location_OnBottom);
+    const HeapUsage withDocked = HeapUsage::current();
+    printDelta("Docking (Frame, TitleBar, TabWidget, Item, Separator)", withHidden, withDocked, numDockWidgets);
+
+    const QVector<DockWidgetBase *> tabbed = createDockWidgets(QStringLiteral("tabbed"), numDockWidgets);
+    const HeapUsage withTabbedHidden = HeapUsage::current();
+    for (int i = 0; i < tabbed.size(); ++i)
+        docked.at(i)->addDockWidgetAsTab(tabbed.at(i));
+    const HeapUsage withTabbed = HeapUsage::current();
+    printDelta("Tabbing into an existing frame", withTabbedHidden, withTabbed, numDockWidgets);
+
+    for (DockWidgetBase *dw : tabbed)
+        dw->close();
+    const HeapUsage withClosed = HeapUsage::current();
+    printDelta("Closing a tab, keeps a placeholder (Position, ItemRef)", withTabbed, withClosed, numDockWidgets);
+
+    const QVector<DockWidgetBase *> floating = createDockWidgets(QStringLiteral("floating"), numDockWidgets);
+    const HeapUsage withFloatingHidden = HeapUsage::current();
+    for (DockWidgetBase *dw : floating)
+        dw->show();
+    const HeapUsage withFloating = HeapUsage::current();
+    printDelta("Floating (FloatingWindow, DropArea, indicators, Frame, TitleBars)", withFloatingHidden, withFloating, numDockWidgets);
+
+    Testing::deleteAll();
+    const HeapUsage afterDelete = HeapUsage::current();
+    printDelta("Left after deleting everything", baseline, afterDelete);
+
+    s_measuringFactory = nullptr; // Deleted by Config
+    Config::self().setFrameworkWidgetFactory(new DefaultWidgetFactory());
+}
+
+/// Returns false if the heap grew more than @p toleranceBytes over the cycles
+static bool measureLeaks(int numCycles, quint32 seed, qint64 toleranceBytes)
+{
+    std::cout << "\nRunning fuzzer seed " << seed << " for " << numCycles << " cycles:\n";
+
+    Fuzzer fuzzer(/*dumpJsonOnFailure=*/ true, Fuzzer::Option_Fast);
+
+    // The first cycle is the warm up, it fills Qt's caches
+    fuzzer.fuzzSeedRange(seed, seed);
+    const HeapUsage baseline = HeapUsage::current();
+
+    HeapUsage last = baseline;
+    for (int i = 1; i <= numCycles; ++i) {
+        fuzzer.fuzzSeedRange(seed, seed);
+        last = HeapUsage::current();
+        std::cout << "  cycle " << i << ": " << last.bytes - baseline.bytes << " bytes over baseline\n";
+    }
+
+    const qint64 growth = last.bytes - baseline.bytes;
+    if (growth > toleranceBytes) {
+        std::cout << "\nFAIL: memory didn't return to the baseline, grew " << growth << " bytes after "
+                  << numCycles << " cycles\n";
+        return false;
+    }
+
+    std::cout << "\nPASS: memory returned to the baseline\n";
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (!qpaPassedAsArgument(argc, argv)) {
+        // Use offscreen by default as it's less annoying, doesn't create visible windows
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Memory footprint and leak harness");
+
+    QCommandLineOption docksOption("docks", QCoreApplication::translate("main", "Dock widgets per footprint measurement"), "count", "20");
+    parser.addOption(docksOption);
+
+    QCommandLineOption cyclesOption("cycles", QCoreApplication::translate("main", "Fuzzer test cycles for the leak check"), "count", "20");
+    parser.addOption(cyclesOption);
+
+    QCommandLineOption seedOption("seed", QCoreApplication::translate("main", "Fuzzer seed to run in each cycle"), "seed", "1");
+    parser.addOption(seedOption);
+
+    QCommandLineOption toleranceOption("tolerance", QCoreApplication::translate("main", "Bytes the heap may grow before it's considered a leak"), "bytes", "65536");
+    parser.addOption(toleranceOption);
+
+    parser.addHelpOption();
+    parser.process(app);
+
+    const int numDockWidgets = qMax(1, parser.value(docksOption).toInt());
+    const int numCycles = qMax(1, parser.value(cyclesOption).toInt());
+    const quint32 seed = parser.value(seedOption).toUInt();
+    const qint64 tolerance = parser.value(toleranceOption).toLongLong();
+
+    int exitCode = 0;
+    QTimer::singleShot(0, &app, [&app, &exitCode, numDockWidgets, numCycles, seed, tolerance] {
+        measureFootprint(numDockWidgets);
+        if (!measureLeaks(numCycles, seed, tolerance))
+            exitCode = 1;
+        app.quit();
+    });
+
+    app.setQuitOnLastWindowClosed(false);
+    app.exec();
+    return exitCode;
+}
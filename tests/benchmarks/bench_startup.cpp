@@ -0,0 +1,337 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2019-2020 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+// We don't care about performance related checks in the tests
+// clazy:excludeall=ctor-missing-parent-argument,missing-qobject-macro,range-loop,missing-typeinfo,detaching-member,function-args-by-ref,non-pod-global-static,reserve-candidates,qstring-allocations
+
+/**
+ * Measures the startup cost of a synthetic layout and of switching between perspectives.
+ *
+ * The layout has a configurable number of dock widgets, tabs per frame, floating windows and
+ * nesting depth, like a big application would. Reports, as json:
+ *   - time to first paint: creating the main window and dock widgets until the first paint
+ *   - LayoutSaver::restoreLayout() wall time, restoring the current layout
+ *   - perspective switch: restoring a different layout until it's painted
+ */
+
+#include "DockWidgetBase.h"
+#include "MainWindow.h"
+#include "LayoutSaver.h"
+#include "DockRegistry_p.h"
+#include "../utils.h"
+#include "../Testing.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QLabel>
+#include <QTimer>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::Tests;
+
+#ifndef KDDOCKWIDGETS_VERSION_STRING
+# define KDDOCKWIDGETS_VERSION_STRING "unknown"
+#endif
+
+struct BenchmarkConfig {
+    int numDockWidgets;
+    int numTabsPerFrame;
+    int numFloatingWindows;
+    int nestingDepth;
+    int numPerspectives;
+    int numIterations;
+
+    QVariantMap toVariantMap() const
+    {
+        QVariantMap map;
+        map[QStringLiteral("numDockWidgets")] = numDockWidgets;
+        map[QStringLiteral("numTabsPerFrame")] = numTabsPerFrame;
+        map[QStringLiteral("numFloatingWindows")] = numFloatingWindows;
+        map[QStringLiteral("nestingDepth")] = nestingDepth;
+        map[QStringLiteral("numPerspectives")] = numPerspectives;
+        map[QStringLiteral("numIterations")] = numIterations;
+        return map;
+    }
+};
+
+/// Tells when any widget of a window got painted
+class PaintWatcher : public QObject
+{
+public:
+    explicit PaintWatcher(QWidget *window)
+        : m_window(window)
+    {
+        qApp->installEventFilter(this);
+    }
+
+    ~PaintWatcher() override
+    {
+        qApp->removeEventFilter(this);
+    }
+
+    bool eventFilter(QObject *watched, QEvent *ev) override
+    {
+        if (ev->type() == QEvent::Paint) {
+            auto widget = qobject_cast<QWidget *>(watched);
+            if (widget && widget->window() == m_window)
+                m_painted = true;
+        }
+
+        return false;
+    }
+
+    /// Processes events until m_window gets painted. Returns false on timeout
+    bool waitForPaint(int timeoutMs = 5000)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!m_painted && timer.elapsed() < timeoutMs)
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+
+        const bool painted = m_painted;
+        m_painted = false;
+        return painted;
+    }
+
+private:
+    QWidget *const m_window;
+    bool m_painted = false;
+};
+
+static QVariantMap statsToVariantMap(QVector<double> samples)
+{
+    QVariantMap map;
+    if (samples.isEmpty())
+        return map;
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples)
+        sum += s;
+
+    map[QStringLiteral("min")] = samples.first();
+    map[QStringLiteral("median")] = samples.at(samples.size() / 2);
+    map[QStringLiteral("max")] = samples.last();
+    map[QStringLiteral("mean")] = sum / samples.size();
+    return map;
+}
+
+static double elapsedMs(const QElapsedTimer &timer)
+{
+    return timer.nsecsElapsed() / 1000000.0;
+}
+
+static QVector<DockWidgetBase *> createDockWidgets(int num)
+{
+    QVector<DockWidgetBase *> dockWidgets;
+    dockWidgets.reserve(num);
+    for (int i = 0; i < num; ++i) {
+        const QString name = QStringLiteral("dock-%1").arg(i);
+        auto dock = createDockWidget(name, new QLabel(name), {}, /*show=*/ false);
+        dockWidgets << dock;
+    }
+
+    return dockWidgets;
+}
+
+/// Places the dock widgets in a random arrangement with the configured amount of floating windows,
+/// tabs and nesting. The same @p seed gives the same arrangement.
+static void arrangeLayout(MainWindowBase *mainWindow, const QVector<DockWidgetBase *> &dockWidgets,
+                          const BenchmarkConfig &config, quint32 seed)
+{
+    std::mt19937 randomEngine(seed);
+    QVector<DockWidgetBase *> shuffled = dockWidgets;
+    std::shuffle(shuffled.begin(), shuffled.end(), randomEngine);
+
+    const int numFloating = qMin(config.numFloatingWindows, shuffled.size());
+    for (int i = 0; i < numFloating; ++i) {
+        DockWidgetBase *dock = shuffled.at(i);
+        dock->show();
+        dock->window()->setGeometry(1700 + (i % 10) * 30, 50 + (i / 10) * 30, 400, 300);
+    }
+
+    DockWidgetBase *previousFrame = nullptr;
+    int depth = 0;
+    for (int i = numFloating; i < shuffled.size(); i += config.numTabsPerFrame) {
+        DockWidgetBase *dock = shuffled.at(i);
+        if (!previousFrame || depth >= config.nestingDepth) {
+            // Starts a new top-level column
+            mainWindow->addDockWidget(dock, Location_OnRight);
+            depth = 1;
+        } else {
+            // Alternating the orientation creates one more nested container each time
+            mainWindow->addDockWidget(dock, depth % 2 ? Location_OnBottom : Location_OnRight, previousFrame);
+            depth++;
+        }
+
+        previousFrame = dock;
+
+        const int lastTab = qMin(i + config.numTabsPerFrame, shuffled.size());
+        for (int j = i + 1; j < lastTab; ++j)
+            dock->addDockWidgetAsTab(shuffled.at(j));
+    }
+}
+
+static QVariantMap runBenchmark(const BenchmarkConfig &config)
+{
+    // 1. Time to first paint, from nothing to a painted main window
+    QVector<double> firstPaintSamples;
+    for (int i = 0; i < config.numIterations; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+
+        auto mainWindow = new MainWindow(QStringLiteral("bench-main"));
+        PaintWatcher watcher(mainWindow);
+        const QVector<DockWidgetBase *> dockWidgets = createDockWidgets(config.numDockWidgets);
+        arrangeLayout(mainWindow, dockWidgets, config, 0);
+        mainWindow->setGeometry(0, 0, 1600, 1200);
+        mainWindow->show();
+
+        if (!watcher.waitForPaint())
+            qWarning() << "Main window wasn't painted";
+        firstPaintSamples << elapsedMs(timer);
+
+        Testing::deleteAll();
+    }
+
+    // 2. Generate the perspectives, all with the same dock widgets but arranged differently
+    auto mainWindow = new MainWindow(QStringLiteral("bench-main"));
+    mainWindow->setGeometry(0, 0, 1600, 1200);
+    mainWindow->show();
+    PaintWatcher watcher(mainWindow);
+    const QVector<DockWidgetBase *> dockWidgets = createDockWidgets(config.numDockWidgets);
+
+    QVector<QByteArray> perspectives;
+    for (int p = 0; p < config.numPerspectives; ++p) {
+        DockRegistry::self()->clear();
+        arrangeLayout(mainWindow, dockWidgets, config, quint32(p));
+        QCoreApplication::processEvents();
+        perspectives << LayoutSaver().serializeLayout();
+    }
+    watcher.waitForPaint();
+
+    // 3. Restoring what's already there, the cost of LayoutSaver::restoreLayout() itself
+    QVector<double> restoreSamples;
+    for (int i = 0; i < config.numIterations; ++i) {
+        LayoutSaver saver;
+        QElapsedTimer timer;
+        timer.start();
+        if (!saver.restoreLayout(perspectives.last()))
+            qWarning() << "Failed to restore layout";
+        restoreSamples << elapsedMs(timer);
+        watcher.waitForPaint();
+    }
+
+    // 4. Switching to another perspective, until it's painted
+    QVector<double> switchSamples;
+    if (perspectives.size() > 1) {
+        for (int i = 0; i < config.numIterations; ++i) {
+            // Starts at perspective 0, as the last one is the current. Consecutive ones always differ
+            const QByteArray &perspective = perspectives.at(i % perspectives.size());
+            LayoutSaver saver;
+            QElapsedTimer timer;
+            timer.start();
+            if (!saver.restoreLayout(perspective))
+                qWarning() << "Failed to restore layout";
+            if (!watcher.waitForPaint())
+                qWarning() << "Main window wasn't painted";
+            switchSamples << elapsedMs(timer);
+        }
+    }
+
+    Testing::deleteAll();
+
+    QVariantMap result;
+    result[QStringLiteral("version")] = QStringLiteral(KDDOCKWIDGETS_VERSION_STRING);
+    result[QStringLiteral("qtVersion")] = QString::fromLatin1(qVersion());
+    result[QStringLiteral("config")] = config.toVariantMap();
+    result[QStringLiteral("coldTimeToFirstPaintMs")] = firstPaintSamples.isEmpty() ? 0.0 : firstPaintSamples.first();
+    result[QStringLiteral("timeToFirstPaintMs")] = statsToVariantMap(firstPaintSamples);
+    result[QStringLiteral("restoreLayoutMs")] = statsToVariantMap(restoreSamples);
+    result[QStringLiteral("perspectiveSwitchMs")] = statsToVariantMap(switchSamples);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    if (!qpaPassedAsArgument(argc, argv)) {
+        // Use offscreen by default as it's less annoying, doesn't create visible windows
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Startup and perspective switch benchmark");
+
+    QCommandLineOption docksOption("docks", QCoreApplication::translate("main", "Number of dock widgets"), "count", "50");
+    parser.addOption(docksOption);
+
+    QCommandLineOption tabsOption("tabs", QCoreApplication::translate("main", "Dock widgets per frame, tabbed"), "count", "2");
+    parser.addOption(tabsOption);
+
+    QCommandLineOption floatingOption("floating", QCoreApplication::translate("main", "Number of floating windows"), "count", "5");
+    parser.addOption(floatingOption);
+
+    QCommandLineOption nestingOption("nesting", QCoreApplication::translate("main", "Nesting depth of the docked frames"), "depth", "3");
+    parser.addOption(nestingOption);
+
+    QCommandLineOption perspectivesOption("perspectives", QCoreApplication::translate("main", "Number of perspectives to switch between"), "count", "3");
+    parser.addOption(perspectivesOption);
+
+    QCommandLineOption iterationsOption("iterations", QCoreApplication::translate("main", "Samples per measurement"), "count", "5");
+    parser.addOption(iterationsOption);
+
+    QCommandLineOption jsonOption("json", QCoreApplication::translate("main", "Writes the results to a json file instead of stdout"), "file");
+    parser.addOption(jsonOption);
+
+    parser.addHelpOption();
+    parser.process(app);
+
+    BenchmarkConfig config;
+    config.numDockWidgets = qMax(1, parser.value(docksOption).toInt());
+    config.numTabsPerFrame = qMax(1, parser.value(tabsOption).toInt());
+    config.numFloatingWindows = qMax(0, parser.value(floatingOption).toInt());
+    config.nestingDepth = qMax(1, parser.value(nestingOption).toInt());
+    config.numPerspectives = qMax(1, parser.value(perspectivesOption).toInt());
+    config.numIterations = qMax(1, parser.value(iterationsOption).toInt());
+
+    const QString jsonFile = parser.value(jsonOption);
+
+    int exitCode = 0;
+    QTimer::singleShot(0, &app, [&app, &exitCode, config, jsonFile] {
+        const QByteArray json = QJsonDocument::fromVariant(runBenchmark(config)).toJson();
+        if (jsonFile.isEmpty()) {
+            std::cout << json.constData();
+        } else {
+            QFile file(jsonFile);
+            if (file.open(QIODevice::WriteOnly)) {
+                file.write(json);
+            } else {
+                std::cerr << "\nFailed to write " << jsonFile.toStdString() << "\n";
+                exitCode = 1;
+            }
+        }
+
+        app.quit();
+    });
+
+    app.setQuitOnLastWindowClosed(false);
+    app.exec();
+    return exitCode;
+}
@@ -17,17 +17,29 @@
 #include "DockWidget.h"
 #include "MainWindow.h"
 
+#include <QElapsedTimer>
 #include <QJsonDocument>
+#include <QMetaEnum>
+#include <QPointF>
 
 #include <QString>
 #include <QTest>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::Testing;
 using namespace KDDockWidgets::Testing::Operations;
 
 #define OPERATIONS_PER_TEST 200
 
+// An operation whose guest geometry changes or solver allocations grow faster than
+// n^SUPERLINEAR_EXPONENT, where n is the number of dock widgets, is reported as a performance
+// regression in benchmark mode. Those counters are deterministic. The wall time is only printed,
+// it's too noisy to fail on
+#define SUPERLINEAR_EXPONENT 1.5
+
 static MainWindow* createMainWindow(const Fuzzer::MainWindowDescriptor &mwd)
 {
     auto mainWindow = new MainWindow(mwd.name, mwd.mainWindowOption);
@@ -53,6 +65,53 @@ static DockWidget* createDockWidget(const Fuzzer::DockWidgetDescriptor &dwd)
     return dockWidget;
 }
 
+/// Least-squares fit of log(cost) over log(numDockWidgets), returns k for cost ~ n^k
+static double scalingExponent(const QMap<int, double> &meanCostPerDockCount)
+{
+    QVector<QPointF> points;
+    for (auto it = meanCostPerDockCount.cbegin(), end = meanCostPerDockCount.cend(); it != end; ++it) {
+        if (it.key() > 0 && it.value() > 0)
+            points << QPointF(std::log(it.key()), std::log(it.value()));
+    }
+
+    if (points.size() < 3) // Not enough data for a trend
+        return 0;
+
+    double meanX = 0;
+    double meanY = 0;
+    for (QPointF p : points) {
+        meanX += p.x();
+        meanY += p.y();
+    }
+    meanX /= points.size();
+    meanY /= points.size();
+
+    double numerator = 0;
+    double denominator = 0;
+    for (QPointF p : points) {
+        numerator += (p.x() - meanX) * (p.y() - meanY);
+        denominator += (p.x() - meanX) * (p.x() - meanX);
+    }
+
+    return qFuzzyIsNull(denominator) ? 0 : numerator / denominator;
+}
+
+template <typename Getter>
+static QMap<int, double> meanCostPerDockCount(const QVector<Fuzzer::OperationCost> &costs, Getter getter)
+{
+    QMap<int, double> sums;
+    QMap<int, int> counts;
+    for (const Fuzzer::OperationCost &cost : costs) {
+        sums[cost.numDockWidgets] += getter(cost);
+        counts[cost.numDockWidgets]++;
+    }
+
+    for (auto it = sums.begin(), end = sums.end(); it != end; ++it)
+        it.value() /= counts.value(it.key());
+
+    return sums;
+}
+
 static void createLayout(const Fuzzer::Layout &layout)
 {
     for (const Fuzzer::MainWindowDescriptor &mwd : layout.mainWindows) {
@@ -73,6 +132,8 @@ void Fuzzer::runTest(const Test &test)
         qFatal("There's dock widgets and the start runTest");
 
     const bool skipsLast = m_options & Option_SkipLast;
+    const bool benchmarks = m_options & Option_Benchmark;
+    const bool fast = m_options & Option_Fast;
     createLayout(test.initialLayout);
     int index = 0;
 
@@ -92,30 +153,57 @@ void Fuzzer::runTest(const Test &test)
             qDebug() << "Running the bad guy:";
         }
 #endif
-        op->execute();
-        if (op->hasParams())
-            qDebug() << "Ran" << op->description() << index;
-        QTest::qWait(m_operationDelayMS);
+        if (benchmarks) {
+            const Statistics before = Statistics::snapshot();
+            QElapsedTimer timer;
+            timer.start();
+            op->execute();
+            recordCost(op, timer.nsecsElapsed(), before);
+        } else {
+            op->execute();
+        }
+
+        if (op->hasParams()) {
+            m_numOperationsRun++;
+            if (!fast)
+                qDebug() << "Ran" << op->description() << index;
+        }
+
+        if (fast)
+            quiesce();
+        else
+            QTest::qWait(m_operationDelayMS);
+
         DockRegistry::self()->checkSanityAll();
     }
 
     if (skipsLast)
         qDebug() << "Skipped" << last->toString() << "\n";
 
-    const bool willQuit = !(m_options & Option_NoQuit);
-    if (willQuit) {
-        for (MainWindowBase *mw : DockRegistry::self()->mainwindows())
-            delete mw;
+    m_numTestsRun++;
 
-        for (FloatingWindow *fw : DockRegistry::self()->nestedwindows())
-            delete fw;
+    const bool willQuit = !(m_options & Option_NoQuit);
+    if (willQuit)
+        clearRegistry();
+}
 
-        for (DockWidgetBase *dw : DockRegistry::self()->dockwidgets())
-            delete dw;
+void Fuzzer::quiesce()
+{
+    // Instead of sleeping, run the event loop until the layouts have nothing deferred.
+    // Bounded, as applying the pending work can in theory schedule more.
+    DockRegistry *registry = DockRegistry::self();
+    int iterations = 0;
+    do {
+        QCoreApplication::processEvents();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        registry->applyPendingLayoutWork();
+    } while (registry->hasPendingLayoutWork() && ++iterations < 10);
+}
 
-        if (!DockRegistry::self()->isEmpty())
-            qFatal("There's still dock widgets and the end of runTest");
-    }
+void Fuzzer::clearRegistry()
+{
+    if (!Testing::deleteAll())
+        qFatal("There's still dock widgets and the end of runTest");
 }
 
 Fuzzer::Fuzzer(bool dumpJsonOnFailure, Options options, QObject *parent)
@@ -128,7 +216,7 @@ Fuzzer::Fuzzer(bool dumpJsonOnFailure, Options options, QObject *parent)
     Testing::setWarningObserver(this);
 }
 
-Fuzzer::Layout Fuzzer::generateRandomLayout()
+Fuzzer::Layout Fuzzer::generateRandomLayout(int numDockWidgets)
 {
     // for now we only support 1 main window
     Fuzzer::Layout layout;
@@ -142,8 +230,11 @@ Fuzzer::Layout Fuzzer::generateRandomLayout()
     mainWindow.mainWindowOption = MainWindowOption_None; // TODO: Maybe test other options
     layout.mainWindows << mainWindow;
 
-    std::uniform_int_distribution<> numDocksDistrib(1, 10); // TODO: Increase
-    const int numDockWidgets = numDocksDistrib(m_randomEngine);
+    if (numDockWidgets == -1) {
+        std::uniform_int_distribution<> numDocksDistrib(1, 10); // TODO: Increase
+        numDockWidgets = numDocksDistrib(m_randomEngine);
+    }
+
     for (int i = 0; i < numDockWidgets; ++i) {
         layout.dockWidgets << generateRandomDockWidget();
     }
@@ -290,10 +381,10 @@ OperationBase::Ptr Fuzzer::getRandomOperation()
     return OperationBase::newOperation(this, operationType);
 }
 
-Fuzzer::Test Fuzzer::generateRandomTest()
+Fuzzer::Test Fuzzer::generateRandomTest(int numDockWidgets)
 {
     Fuzzer::Test test;
-    test.initialLayout = generateRandomLayout();
+    test.initialLayout = generateRandomLayout(numDockWidgets);
 
     const int numOperationsPerTest = OPERATIONS_PER_TEST;
     test.operations.reserve(numOperationsPerTest);
@@ -316,6 +407,11 @@ Fuzzer::Test::List Fuzzer::generateRandomTests(int num)
 
 void Fuzzer::fuzz(FuzzerConfig config)
 {
+    if (m_options & Option_Benchmark) {
+        benchmark(config);
+        return;
+    }
+
     const Fuzzer::Test::List tests = generateRandomTests(config.numTests);
     qDebug().noquote() << "Running" << QString("%1 tests...").arg(tests.size());
 
@@ -330,8 +426,154 @@ void Fuzzer::fuzz(const QStringList &jsonFiles)
         qFatal("Use -d only when passing a single json file");
     }
 
+    m_operationCosts.clear();
+    m_worstCosts.clear();
+    m_worstTests.clear();
+
     for (const QString &jsonFile : jsonFiles)
         fuzz(jsonFile);
+
+    if (m_options & Option_Benchmark)
+        reportScaling();
+}
+
+void Fuzzer::fuzzSeedRange(quint32 firstSeed, quint32 lastSeed)
+{
+    m_firstSeed = firstSeed;
+    m_lastSeed = lastSeed;
+    m_numTestsRun = 0;
+    m_numOperationsRun = 0;
+    m_runTimer.start();
+
+    qDebug().noquote() << "Running" << QString("seeds %1 to %2...").arg(firstSeed).arg(lastSeed);
+
+    // quint64 so we don't overflow when lastSeed is the maximum
+    for (quint64 seed = firstSeed; seed <= lastSeed; ++seed) {
+        m_currentSeed = qint64(seed);
+        m_randomEngine.seed(quint32(seed));
+        runTest(generateRandomTest());
+    }
+
+    m_currentSeed = -1;
+    writeReport(/*failed=*/ false);
+}
+
+void Fuzzer::setReportFile(const QString &filename)
+{
+    m_reportFile = filename;
+}
+
+void Fuzzer::writeReport(bool failed) const
+{
+    if (m_reportFile.isEmpty())
+        return;
+
+    QVariantMap map;
+    map[QStringLiteral("firstSeed")] = m_firstSeed;
+    map[QStringLiteral("lastSeed")] = m_lastSeed;
+    map[QStringLiteral("numTests")] = m_numTestsRun;
+    map[QStringLiteral("numOperations")] = m_numOperationsRun;
+    map[QStringLiteral("elapsedMs")] = m_runTimer.isValid() ? m_runTimer.elapsed() : 0;
+    if (failed)
+        map[QStringLiteral("failedSeed")] = m_currentSeed;
+
+    QFile file(m_reportFile);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(QJsonDocument::fromVariant(map).toJson());
+    } else {
+        qDebug() << Q_FUNC_INFO << "Error opening file" << m_reportFile;
+    }
+}
+
+void Fuzzer::benchmark(FuzzerConfig config)
+{
+    m_operationCosts.clear();
+    m_worstCosts.clear();
+    m_worstTests.clear();
+
+    // The layout doubles in size each round, so we can fit how each operation scales
+    const int dockWidgetCounts[] = { 4, 8, 16, 32, 64 };
+    for (int numDockWidgets : dockWidgetCounts) {
+        qDebug().noquote() << "Benchmarking" << QString("%1 tests with %2 dock widgets...").arg(config.numTests).arg(numDockWidgets);
+        for (int i = 0; i < config.numTests; ++i)
+            runTest(generateRandomTest(numDockWidgets));
+    }
+
+    reportScaling();
+}
+
+void Fuzzer::recordCost(const OperationBase::Ptr &op, qint64 nsecs, const Statistics &before)
+{
+    if (!op->hasParams()) // It didn't run
+        return;
+
+    const Statistics after = Statistics::snapshot();
+
+    OperationCost cost;
+    cost.numDockWidgets = DockRegistry::self()->dockwidgets().size();
+    cost.nsecs = nsecs;
+    cost.guestGeometryChanges = after.numGuestGeometryChanges - before.numGuestGeometryChanges;
+    cost.solverAllocations = after.numSolverAllocations - before.numSolverAllocations;
+
+    const OperationType type = op->type();
+    m_operationCosts[type].push_back(cost);
+
+    // Remember the most expensive run at the biggest layout, that's the one worth replaying
+    auto it = m_worstCosts.find(type);
+    if (it == m_worstCosts.end() || cost.numDockWidgets > it->numDockWidgets
+        || (cost.numDockWidgets == it->numDockWidgets && cost.nsecs > it->nsecs)) {
+        m_worstCosts[type] = cost;
+        m_worstTests[type] = m_currentTest;
+    }
+}
+
+void Fuzzer::reportScaling()
+{
+    m_foundPerformanceRegression = false;
+    const QMetaEnum metaEnum = QMetaEnum::fromType<OperationType>();
+
+    for (auto it = m_operationCosts.cbegin(), end = m_operationCosts.cend(); it != end; ++it) {
+        const QString name = QString::fromLatin1(metaEnum.valueToKey(it.key()));
+        const OperationCost::List &costs = it.value();
+
+        const QMap<int, double> meanNsecs = meanCostPerDockCount(costs, [] (const OperationCost &c) {
+            return double(c.nsecs);
+        });
+        const QMap<int, double> meanGeometryChanges = meanCostPerDockCount(costs, [] (const OperationCost &c) {
+            return double(c.guestGeometryChanges);
+        });
+        const QMap<int, double> meanAllocations = meanCostPerDockCount(costs, [] (const OperationCost &c) {
+            return double(c.solverAllocations);
+        });
+
+        for (auto costIt = meanNsecs.cbegin(), costEnd = meanNsecs.cend(); costIt != costEnd; ++costIt) {
+            const int n = costIt.key();
+            qDebug().noquote() << QString("%1 with %2 dock widgets: %3us, %4 geometry changes, %5 allocations")
+                                  .arg(name).arg(n).arg(costIt.value() / 1000, 0, 'f', 1)
+                                  .arg(meanGeometryChanges.value(n), 0, 'f', 1)
+                                  .arg(meanAllocations.value(n), 0, 'f', 1);
+        }
+
+        const double timeExponent = scalingExponent(meanNsecs);
+        const double geometryChangesExponent = scalingExponent(meanGeometryChanges);
+        const double allocationsExponent = scalingExponent(meanAllocations);
+        qDebug().noquote() << QString("%1 scales as: time ~ n^%2, geometry changes ~ n^%3, allocations ~ n^%4")
+                              .arg(name).arg(timeExponent, 0, 'f', 2)
+                              .arg(geometryChangesExponent, 0, 'f', 2)
+                              .arg(allocationsExponent, 0, 'f', 2);
+
+        if (std::max(geometryChangesExponent, allocationsExponent) > SUPERLINEAR_EXPONENT) {
+            m_foundPerformanceRegression = true;
+            const QString filename = QStringLiteral("fuzzer_perf_%1.json").arg(name);
+            m_worstTests.value(it.key()).dumpToJsonFile(filename);
+            qWarning().noquote() << name << "grows super-linearly with the number of dock widgets. Dumped" << filename;
+        }
+    }
+}
+
+bool Fuzzer::foundPerformanceRegression() const
+{
+    return m_foundPerformanceRegression;
 }
 
 void Fuzzer::fuzz(const QString &jsonFile)
@@ -364,13 +606,20 @@ QRect Fuzzer::randomGeometry()
 void Fuzzer::onFatal()
 {
     if (m_dumpJsonOnFailure) {
-        // Tests failed! Let's dump
-        m_currentTest.dumpToJsonFile("fuzzer_dump.json");
+        // Tests failed! Let's dump. Seeded runs can be sharded, so don't let them overwrite each other's dumps
+        const QString filename = m_currentSeed == -1 ? QStringLiteral("fuzzer_dump.json")
+                                                     : QStringLiteral("fuzzer_dump_seed%1.json").arg(m_currentSeed);
+        m_currentTest.dumpToJsonFile(filename);
     }
 
     if (!m_currentJsonFile.isEmpty()) {
         qDebug() << "failed json: " << m_currentJsonFile;
     }
+
+    if (m_currentSeed != -1) {
+        qDebug() << "failed seed: " << m_currentSeed;
+        writeReport(/*failed=*/ true);
+    }
 }
 
 void Fuzzer::setDelayBetweenOperations(int delay)
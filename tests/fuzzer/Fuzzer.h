@@ -18,8 +18,11 @@
 #include "../Testing.h"
 #include "MainWindowBase.h"
 #include "Operations.h"
+#include "Statistics.h"
 
+#include <QElapsedTimer>
 #include <QJsonDocument>
+#include <QMap>
 #include <QVector>
 
 #include <random>
@@ -64,7 +67,9 @@ public:
     enum Option {
         Option_None = 0,
         Option_NoQuit = 1, ///< Don't quit when the tests finish. So we can debug in gammaray
-        Option_SkipLast = 2 ///< Don't execute the last test. Useful when the last one is the failing one and we want to inspect the state prior to crash
+        Option_SkipLast = 2, ///< Don't execute the last test. Useful when the last one is the failing one and we want to inspect the state prior to crash
+        Option_Benchmark = 4, ///< Measures the cost of each operation while the layout grows and reports the operations scaling super-linearly
+        Option_Fast = 8 ///< Doesn't sleep between operations, only waits until the layouts have no pending work
     };
     Q_DECLARE_FLAGS(Options, Option)
 
@@ -224,11 +229,21 @@ public:
         }
     };
 
+    ///@brief The cost of running an operation, recorded in benchmark mode
+    struct OperationCost {
+        typedef QVector<OperationCost> List;
+        int numDockWidgets = 0;
+        qint64 nsecs = 0;
+        qint64 guestGeometryChanges = 0;
+        qint64 solverAllocations = 0;
+    };
+
     void runTest(const Test &);
 
     explicit Fuzzer(bool dumpJsonOnFailure, Options, QObject *parent = nullptr);
 
-    Fuzzer::Layout generateRandomLayout();
+    ///@brief Generates a layout with @p numDockWidgets dock widgets, or a random amount if -1
+    Fuzzer::Layout generateRandomLayout(int numDockWidgets = -1);
 
     Fuzzer::DockWidgetDescriptor generateRandomDockWidget();
 
@@ -249,13 +264,20 @@ public:
 
     Operations::OperationBase::Ptr getRandomOperation();
 
-    Fuzzer::Test generateRandomTest();
+    Fuzzer::Test generateRandomTest(int numDockWidgets = -1);
     Fuzzer::Test::List generateRandomTests(int num);
 
     void fuzz(FuzzerConfig config);
     void fuzz(const QStringList &jsonFiles);
     void fuzz(const QString &json);
 
+    ///@brief Runs one random test per seed, from @p firstSeed to @p lastSeed inclusive.
+    ///A failing test can then be reproduced just by its seed.
+    void fuzzSeedRange(quint32 firstSeed, quint32 lastSeed);
+
+    ///@brief Sets the file where fuzzSeedRange() writes its json report, also written on failure
+    void setReportFile(const QString &filename);
+
     QRect randomGeometry();
 
     void onFatal() override;
@@ -264,7 +286,17 @@ public:
     QByteArray lastSavedLayout() const;
     void setLastSavedLayout(const QByteArray &serialized);
 
+    ///@brief Returns whether the last benchmark found an operation scaling super-linearly
+    bool foundPerformanceRegression() const;
+
 private:
+    void quiesce();
+    void clearRegistry();
+    void writeReport(bool failed) const;
+    void benchmark(FuzzerConfig config);
+    void recordCost(const Operations::OperationBase::Ptr &, qint64 nsecs, const Statistics &before);
+    void reportScaling();
+
     std::random_device m_randomDevice;
     std::mt19937 m_randomEngine;
     Fuzzer::Test m_currentTest;
@@ -273,6 +305,21 @@ private:
     int m_operationDelayMS = 50;
     const Options m_options;
     QByteArray m_lastSavedLayout;
+
+    // Seeded runs, see fuzzSeedRange()
+    qint64 m_currentSeed = -1;
+    quint32 m_firstSeed = 0;
+    quint32 m_lastSeed = 0;
+    QString m_reportFile;
+    int m_numTestsRun = 0;
+    qint64 m_numOperationsRun = 0;
+    QElapsedTimer m_runTimer;
+
+    // Benchmark mode, see Option_Benchmark
+    QMap<Operations::OperationType, OperationCost::List> m_operationCosts;
+    QMap<Operations::OperationType, OperationCost> m_worstCosts;
+    QMap<Operations::OperationType, Fuzzer::Test> m_worstTests;
+    bool m_foundPerformanceRegression = false;
 };
 
 }
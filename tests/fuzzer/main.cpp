@@ -21,11 +21,138 @@
 #include <QTimer>
 #include <QDebug>
 #include <QFile>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QProcess>
+#include <QTemporaryDir>
 #include <iostream>
 
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::Testing;
 
+static bool parseSeedRange(const QString &str, quint32 &firstSeed, quint32 &lastSeed)
+{
+    const QStringList parts = str.split(QLatin1Char(':'));
+    if (parts.size() != 2)
+        return false;
+
+    bool ok1 = false;
+    bool ok2 = false;
+    firstSeed = parts.at(0).toUInt(&ok1);
+    lastSeed = parts.at(1).toUInt(&ok2);
+    return ok1 && ok2 && firstSeed <= lastSeed;
+}
+
+struct Shard {
+    quint32 firstSeed;
+    quint32 lastSeed;
+    QString reportFile;
+    QProcess *process;
+};
+
+static QProcess *startShard(quint32 firstSeed, quint32 lastSeed, const QString &reportFile)
+{
+    QFile::remove(reportFile); // So a crash isn't mistaken for a stale report
+
+    auto process = new QProcess();
+    process->setProcessChannelMode(QProcess::ForwardedChannels);
+    process->start(QCoreApplication::applicationFilePath(),
+                   { QStringLiteral("--fast"),
+                     QStringLiteral("--seeds"), QStringLiteral("%1:%2").arg(firstSeed).arg(lastSeed),
+                     QStringLiteral("--report"), reportFile });
+    return process;
+}
+
+/// Splits the seed range across @p numShards fuzzer processes and merges their reports.
+/// A shard that fails is restarted after the failing seed, so one bug doesn't stop the whole run.
+/// Returns the exit code
+static int runShards(int numShards, quint32 firstSeed, quint32 lastSeed, const QString &reportFile)
+{
+    QTemporaryDir tmpDir;
+    if (!tmpDir.isValid()) {
+        std::cerr << "\nCouldn't create a temporary directory for the shard reports\n";
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const quint64 numSeeds = quint64(lastSeed) - firstSeed + 1;
+    const quint64 seedsPerShard = (numSeeds + numShards - 1) / numShards;
+
+    QVector<Shard> running;
+    int numStarted = 0;
+    for (quint64 first = firstSeed; first <= lastSeed; first += seedsPerShard) {
+        const quint32 last = quint32(qMin<quint64>(first + seedsPerShard - 1, lastSeed));
+        const QString shardReport = tmpDir.filePath(QStringLiteral("shard_%1.json").arg(numStarted++));
+        running.push_back({ quint32(first), last, shardReport, startShard(quint32(first), last, shardReport) });
+    }
+
+    qint64 numTests = 0;
+    qint64 numOperations = 0;
+    QVariantList failedSeeds;
+    QVariantList crashedRanges;
+
+    while (!running.isEmpty()) {
+        const Shard shard = running.takeFirst();
+        shard.process->waitForFinished(-1);
+        const bool succeeded = shard.process->exitStatus() == QProcess::NormalExit && shard.process->exitCode() == 0;
+        delete shard.process;
+
+        QFile file(shard.reportFile);
+        if (!file.open(QIODevice::ReadOnly)) {
+            // Died without going through Fuzzer::onFatal(), we can't tell which seed
+            crashedRanges << QStringLiteral("%1:%2").arg(shard.firstSeed).arg(shard.lastSeed);
+            continue;
+        }
+
+        const QVariantMap report = QJsonDocument::fromJson(file.readAll()).toVariant().toMap();
+        numTests += report.value(QStringLiteral("numTests")).toLongLong();
+        numOperations += report.value(QStringLiteral("numOperations")).toLongLong();
+
+        if (report.contains(QStringLiteral("failedSeed"))) {
+            const quint32 failedSeed = report.value(QStringLiteral("failedSeed")).toUInt();
+            failedSeeds << failedSeed;
+            if (failedSeed < shard.lastSeed) {
+                const QString shardReport = tmpDir.filePath(QStringLiteral("shard_%1.json").arg(numStarted++));
+                running.push_back({ failedSeed + 1, shard.lastSeed, shardReport,
+                                    startShard(failedSeed + 1, shard.lastSeed, shardReport) });
+            }
+        } else if (!succeeded) {
+            crashedRanges << QStringLiteral("%1:%2").arg(shard.firstSeed).arg(shard.lastSeed);
+        }
+    }
+
+    const qint64 elapsedMs = timer.elapsed();
+    QVariantMap merged;
+    merged[QStringLiteral("firstSeed")] = firstSeed;
+    merged[QStringLiteral("lastSeed")] = lastSeed;
+    merged[QStringLiteral("numShards")] = numShards;
+    merged[QStringLiteral("numTests")] = numTests;
+    merged[QStringLiteral("numOperations")] = numOperations;
+    merged[QStringLiteral("elapsedMs")] = elapsedMs;
+    merged[QStringLiteral("failedSeeds")] = failedSeeds;
+    merged[QStringLiteral("crashedRanges")] = crashedRanges;
+
+    std::cout << "\nRan " << numTests << " tests, " << numOperations << " operations in "
+              << elapsedMs << "ms across " << numShards << " shards. "
+              << failedSeeds.size() << " failed seeds, " << crashedRanges.size() << " crashed ranges\n";
+    for (const QVariant &seed : failedSeeds)
+        std::cout << "Failed seed: " << seed.toUInt() << " (see fuzzer_dump_seed" << seed.toUInt() << ".json)\n";
+    for (const QVariant &range : crashedRanges)
+        std::cout << "Crashed without report: " << range.toString().toStdString() << "\n";
+
+    if (!reportFile.isEmpty()) {
+        QFile file(reportFile);
+        if (file.open(QIODevice::WriteOnly))
+            file.write(QJsonDocument::fromVariant(merged).toJson());
+        else
+            std::cerr << "\nFailed to write " << reportFile.toStdString() << "\n";
+    }
+
+    return failedSeeds.isEmpty() && crashedRanges.isEmpty() ? 0 : 1;
+}
+
 int main(int argc, char **argv)
 {
     if (!qpaPassedAsArgument(argc, argv)) {
@@ -54,6 +181,21 @@ int main(int argc, char **argv)
     QCommandLineOption noQuitOption("n", QCoreApplication::translate("main", "Don't quit at the end, keep event loop running for debugging"));
     parser.addOption(noQuitOption);
 
+    QCommandLineOption benchmarkOption("p", QCoreApplication::translate("main", "Performance regression mode. Measures each operation while the layout grows and dumps the ones whose geometry changes or allocations scale super-linearly"));
+    parser.addOption(benchmarkOption);
+
+    QCommandLineOption fastOption("fast", QCoreApplication::translate("main", "Don't sleep between operations, just wait until the layouts have no pending work"));
+    parser.addOption(fastOption);
+
+    QCommandLineOption seedsOption("seeds", QCoreApplication::translate("main", "Runs one test per seed, from first to last inclusive. A failing test can be rerun with its seed"), "first:last");
+    parser.addOption(seedsOption);
+
+    QCommandLineOption shardsOption("shards", QCoreApplication::translate("main", "Splits --seeds across N fuzzer processes, in fast mode, and merges their reports"), "N");
+    parser.addOption(shardsOption);
+
+    QCommandLineOption reportOption("report", QCoreApplication::translate("main", "Writes a json report of the --seeds run"), "file");
+    parser.addOption(reportOption);
+
     parser.addHelpOption();
     parser.process(app);
 
@@ -71,11 +213,43 @@ int main(int argc, char **argv)
     if (parser.isSet(noQuitOption))
         options |= Fuzzer::Option_NoQuit;
 
+    if (parser.isSet(benchmarkOption)) {
+        if (options & Fuzzer::Option_NoQuit) {
+            std::cerr << "\n-p and -n can't be used together\n";
+            return 0;
+        }
+        options |= Fuzzer::Option_Benchmark;
+    }
+
+    if (parser.isSet(fastOption))
+        options |= Fuzzer::Option_Fast;
+
+    quint32 firstSeed = 0;
+    quint32 lastSeed = 0;
+    const bool seeded = parser.isSet(seedsOption);
+    if (seeded && !parseSeedRange(parser.value(seedsOption), firstSeed, lastSeed)) {
+        std::cerr << "\nInvalid seed range, expected first:last\n";
+        return 1;
+    }
+
+    if (parser.isSet(shardsOption)) {
+        const int numShards = parser.value(shardsOption).toInt();
+        if (!seeded || numShards <= 0) {
+            std::cerr << "\n--shards needs a positive number and --seeds\n";
+            return 1;
+        }
+
+        return runShards(numShards, firstSeed, lastSeed, parser.value(reportOption));
+    }
+
     const bool loops = parser.isSet(loopOption);
 
     Fuzzer fuzzer(dumpToJsonOnFatal, options);
+    fuzzer.setReportFile(parser.value(reportOption));
     if (slowDown)
         fuzzer.setDelayBetweenOperations(1000);
+    else if (options & Fuzzer::Option_Benchmark)
+        fuzzer.setDelayBetweenOperations(0);
 
     for (const QString &file : filesToLoad) {
         if (!QFile::exists(file)) {
@@ -84,8 +258,10 @@ int main(int argc, char **argv)
         }
     }
 
-    QTimer::singleShot(0, &fuzzer, [&app, &fuzzer, filesToLoad, loops, options] {
-        if (filesToLoad.isEmpty()) {
+    QTimer::singleShot(0, &fuzzer, [&app, &fuzzer, filesToLoad, loops, options, seeded, firstSeed, lastSeed] {
+        if (seeded) {
+            fuzzer.fuzzSeedRange(firstSeed, lastSeed);
+        } else if (filesToLoad.isEmpty()) {
             do {
                 fuzzer.fuzz({ 1, 10, true });
             } while(loops);
@@ -95,7 +271,7 @@ int main(int argc, char **argv)
 
         if (!(options & Fuzzer::Option_NoQuit)) {
             // if noQuit is true we keep the app running so it can be debugged
-            app.quit();
+            app.exit(fuzzer.foundPerformanceRegression() ? 1 : 0);
         }
     });
 
@@ -16,6 +16,15 @@
 #include "utils.h"
 #include "DockWidgetBase.h"
 #include "private/MultiSplitter_p.h"
+#include "private/DockRegistry_p.h"
+#include "private/Frame_p.h"
+#include "private/multisplitter/Item_p.h"
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+# include "private/multisplitter/Widget_quick.h"
+# include "private/quick/DockWidgetQuick.h"
+# include <QQuickView>
+#endif
 
 #include <QtTest/QtTest>
 #include <QObject>
@@ -38,10 +47,34 @@ public Q_SLOTS:
 
         // auto m = createMainWindow(); TODO
         // QTest::qWait(10); // the DND state machine needs the event loop to start, otherwise activeState() is nullptr. (for offscreen QPA)
+
+#ifdef KDDOCKWIDGETS_QTQUICK
+        // Items are only polished and QML only incubated asynchronously inside a window
+        m_view = new QQuickView();
+        Config::self().setQmlEngine(m_view->engine());
+        m_view->resize(1000, 800);
+        m_view->show();
+#endif
+    }
+
+    void cleanupTestCase()
+    {
+#ifdef KDDOCKWIDGETS_QTQUICK
+        delete m_view;
+#endif
     }
 
 private Q_SLOTS:
     void tst_simple1();
+#ifdef KDDOCKWIDGETS_QTQUICK
+    void tst_batchGeometryUpdates();
+    void tst_asyncQmlIncubation();
+#endif
+
+private:
+#ifdef KDDOCKWIDGETS_QTQUICK
+    QQuickView *m_view = nullptr;
+#endif
 };
 
 void TestCommon::tst_simple1()
@@ -52,6 +85,101 @@ void TestCommon::tst_simple1()
     m->multiSplitter()->checkSanity();
 }
 
+#ifdef KDDOCKWIDGETS_QTQUICK
+
+// Returns whether the QML items already have the geometries the layout assigned to them
+static bool guestGeometriesMatchLayout(MultiSplitter *layout)
+{
+    for (Layouting::Item *item : layout->items()) {
+        auto guest = qobject_cast<QQuickItem *>(item->guestAsQObject());
+        if (!guest)
+            continue;
+
+        const QRect guestGeometry(int(guest->x()), int(guest->y()), int(guest->width()), int(guest->height()));
+        if (guestGeometry != item->mapToRoot(item->rect()))
+            return false;
+    }
+
+    return true;
+}
+
+void TestCommon::tst_batchGeometryUpdates()
+{
+    // Tests that with Flag_BatchGeometryUpdates the QML items only get their geometry in the next
+    // polish, or when applyPendingLayoutWork() is called
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_BatchGeometryUpdates);
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    m->setParentItem(m_view->contentItem());
+    auto dock1 = createDockWidget("dock1", new MyWidget("dock1", Qt::red), {}, /*show=*/ false);
+    auto dock2 = createDockWidget("dock2", new MyWidget("dock2", Qt::blue), {}, /*show=*/ false);
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+    MultiSplitter *layout = m->multiSplitter();
+    QTRY_VERIFY(!Layouting::Widget_quick::hasPendingGeometries());
+    QVERIFY(guestGeometriesMatchLayout(layout));
+
+    // Relayout. The layout already sees the new geometries, the items only after the next polish
+    auto dock3 = createDockWidget("dock3", new MyWidget("dock3", Qt::green), {}, /*show=*/ false);
+    m->addDockWidget(dock3, Location_OnBottom);
+    QVERIFY(Layouting::Widget_quick::hasPendingGeometries());
+    QVERIFY(!guestGeometriesMatchLayout(layout));
+    QVERIFY(layout->checkSanity());
+    QTRY_VERIFY(!Layouting::Widget_quick::hasPendingGeometries());
+    QVERIFY(guestGeometriesMatchLayout(layout));
+
+    // applyPendingLayoutWork() doesn't wait for the polish
+    dock3->close();
+    QVERIFY(Layouting::Widget_quick::hasPendingGeometries());
+    QVERIFY(!guestGeometriesMatchLayout(layout));
+    DockRegistry::self()->applyPendingLayoutWork();
+    QVERIFY(!Layouting::Widget_quick::hasPendingGeometries());
+    QVERIFY(guestGeometriesMatchLayout(layout));
+    QVERIFY(layout->checkSanity());
+
+    delete dock3;
+}
+
+void TestCommon::tst_asyncQmlIncubation()
+{
+    // Tests that with Flag_AsyncQmlIncubation the guest and the frame's chrome are created in later
+    // frames, and that the dock widget then ends up in the frame's StackLayout
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_AsyncQmlIncubation);
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    m->setParentItem(m_view->contentItem());
+
+    auto dock1 = new DockWidgetQuick("dock1");
+    QSignalSpy contentReadySpy(dock1, &DockWidgetQuick::contentReady);
+    dock1->setWidget(QStringLiteral("qrc:/qml/Guest.qml"));
+    QVERIFY(!dock1->isContentReady());
+    QCOMPARE(contentReadySpy.count(), 0);
+    QWidgetOrQuick *adapter = dock1->widget();
+    QVERIFY(adapter); // Empty, but already there to be laid out
+    QVERIFY(adapter->childItems().isEmpty());
+
+    // Added while Frame.qml is still being incubated, so there's no StackLayout yet
+    m->addDockWidget(dock1, Location_OnLeft);
+    Frame *frame = dock1->frame();
+    QVERIFY(frame);
+    QCOMPARE(dock1->parentItem(), static_cast<QQuickItem *>(frame));
+
+    QTRY_VERIFY(dock1->isContentReady());
+    QCOMPARE(contentReadySpy.count(), 1);
+    QCOMPARE(dock1->widget(), adapter);
+    QCOMPARE(adapter->childItems().size(), 1);
+
+    // Frame.qml registered its StackLayout, which now holds the dock widget
+    QTRY_VERIFY(dock1->parentItem() != frame);
+    QCOMPARE(QByteArray(dock1->parentItem()->metaObject()->className()), QByteArray("QQuickStackLayout"));
+    QCOMPARE(dock1->frame(), frame);
+    QVERIFY(m->multiSplitter()->checkSanity());
+}
+
+#endif
+
 int main(int argc, char *argv[])
 {
     if (!qpaPassedAsArgument(argc, argv)) {
@@ -22,16 +22,22 @@
 #include "private/widgets/TabWidget_p.h"
 #include "DropArea_p.h"
 #include "TitleBar_p.h"
+#include "FramePool_p.h"
+#include "FloatingWindowPool_p.h"
 #include "WindowBeingDragged_p.h"
 #include "Utils_p.h"
 #include "LayoutSaver.h"
 #include "LayoutSaver_p.h"
+#include "Statistics.h"
 #include "MultiSplitter_p.h"
+#include "multisplitter/Item_p.h"
 #include "Position_p.h"
 #include "utils.h"
 #include "FrameworkWidgetFactory.h"
 #include "DropAreaWithCentralFrame_p.h"
 #include "Testing.h"
+#include "private/indicators/ClassicIndicators_p.h"
+#include "private/indicators/SegmentedIndicators_p.h"
 #include "DockWidget.h"
 
 #include <QtTest/QtTest>
@@ -48,6 +54,10 @@
 #include <QStyleFactory>
 #include <QCursor>
 #include <QLineEdit>
+#include <QJsonDocument>
+#include <QRubberBand>
+
+#include <functional>
 
 #ifdef Q_OS_WIN
 # include <Windows.h>
@@ -309,6 +319,7 @@ private Q_SLOTS:
 
     void tst_addDockWidgetAsTabToDockWidget();
     void tst_addDockWidgetToMainWindow(); // Tests MainWindow::addDockWidget();
+    void tst_addDockWidgets();
     void tst_addDockWidgetToContainingWindow();
     void tst_addToSmallMainWindow1();
     void tst_addToSmallMainWindow2();
@@ -322,6 +333,11 @@ private Q_SLOTS:
     void tst_propagateResize2();
 
     void tst_clear();
+    void tst_framePool();
+    void tst_floatingWindowPool();
+    void tst_lazyWidgetFactory();
+    void tst_hibernation();
+    void tst_statistics();
     void tst_constraintsAfterPlaceholder();
     void tst_crash(); // tests some crash I got
     void tst_crash2_data();
@@ -370,6 +386,7 @@ private Q_SLOTS:
     void tst_restoreEmpty();
     void tst_restoreSimplest();
     void tst_restoreSimple();
+    void tst_restoreLayoutAsync();
     void tst_restoreNestedAndTabbed();
     void tst_restoreCentralFrame();
     void tst_restoreCrash();
@@ -387,11 +404,13 @@ private Q_SLOTS:
     void tst_invalidLayoutAfterRestore();
     void tst_invalidJSON_data();
     void tst_invalidJSON();
+    void tst_validateLayout();
 
     void tst_resizeWindow_data();
     void tst_resizeWindow();
     void tst_resizeWindow2();
     void tst_rectForDropCrash();
+    void tst_rectForDropCache();
 
     void tst_tabBarWithHiddenTitleBar_data();
     void tst_tabBarWithHiddenTitleBar();
@@ -399,9 +418,16 @@ private Q_SLOTS:
     void tst_dragByTabBar_data();
     void tst_dragByTabBar();
     void tst_dragBySingleTab();
+    void tst_outlineDragging();
+    void tst_outlineDraggingDefersDetach();
+    void tst_lazyResizeFloatingWindow();
+    void tst_segmentedIndicatorsPartialRepaint();
+    void tst_classicIndicatorsSkipRepaint();
+    void tst_lazyWindowResize();
 
     void tst_addToHiddenMainWindow();
     void tst_minSizeChanges();
+    void tst_sizeConstraintsCache();
     void tst_complex();
     void tst_titlebar_getter();
     void tst_0_data();
@@ -1296,6 +1322,58 @@ void TestDocks::tst_restoreSimple()
     QVERIFY(Testing::waitForDeleted(dock3));
 }
 
+void TestDocks::tst_restoreLayoutAsync()
+{
+    EnsureTopLevelsDeleted e;
+    // Tests that restoreLayoutAsync() restores the same as restoreLayout(), across several event loop iterations
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    auto layout = m->multiSplitter();
+    auto dock1 = createDockWidget("one", new QTextEdit());
+    auto dock2 = createDockWidget("two", new QTextEdit());
+    m->addDockWidget(dock1, Location_OnTop);
+
+    LayoutSaver saver;
+    const QByteArray saved = saver.serializeLayout();
+    dock1->close();
+    dock2->close();
+    QVERIFY(!dock2->isVisible());
+
+    // A time slice of 0 means one step per event loop iteration
+    LayoutRestoreJob *job = saver.restoreLayoutAsync(saved, 0);
+    QSignalSpy progressSpy(job, &LayoutRestoreJob::progressChanged);
+    QSignalSpy finishedSpy(job, &LayoutRestoreJob::finished);
+    QVERIFY(!job->isFinished());
+    QVERIFY(!dock1->isVisible());
+
+    // JSON parsed. The visible main window doesn't paint until the restore finishes
+    QVERIFY(progressSpy.wait());
+    QVERIFY(!m->updatesEnabled());
+
+    // Only raised while a chunk is being restored, so this resize isn't lost
+    QVERIFY(!LayoutSaver::restoreInProgress());
+    m->resize(900, 600);
+
+    QVERIFY(finishedSpy.count() == 1 || finishedSpy.wait());
+    QVERIFY(finishedSpy.at(0).at(0).toBool());
+    QVERIFY(!LayoutSaver::restoreInProgress());
+    QVERIFY(m->updatesEnabled());
+    QCOMPARE(layout->size(), layout->QWidgetAdapter::size());
+
+    // 1 main window, 1 floating window and 2 placeholders, plus the initial notification
+    QCOMPARE(progressSpy.size(), 5);
+    QCOMPARE(progressSpy.last().at(0).toInt(), 4);
+    QCOMPARE(progressSpy.last().at(1).toInt(), 4);
+
+    QVERIFY(layout->checkSanity());
+    QCOMPARE(layout->count(), 1);
+    QVERIFY(dock1->isVisible());
+    auto fw2 = dock2->floatingWindow();
+    QVERIFY(fw2);
+    QVERIFY(fw2->isVisible());
+    QCOMPARE(saver.restoredDockWidgets().size(), 2);
+}
+
 void TestDocks::tst_restoreNestedAndTabbed()
 {
     // Just a more involved test
@@ -1753,6 +1831,45 @@ void TestDocks::tst_addDockWidgetToMainWindow()
      QCOMPARE(dock1->frame()->QWidget::x(), dock2->frame()->QWidget::x());
 }
 
+void TestDocks::tst_addDockWidgets()
+{
+    EnsureTopLevelsDeleted e;
+    auto m = createMainWindow();
+    auto dock1 = createDockWidget("dock1", new QPushButton("one"));
+    auto dock2 = createDockWidget("dock2", new QPushButton("two"));
+    auto dock3 = createDockWidget("dock3", new QPushButton("three"));
+
+    const QVariantList description = {
+        QVariantMap { { "name", "dock1" }, { "location", "right" } },
+        QVariantMap { { "name", "dock2" }, { "location", "top" }, { "relativeTo", "dock1" } },
+        QVariantMap { { "name", "dock3" }, { "tabbedWith", "dock2" } }
+    };
+
+    QVERIFY(m->addDockWidgets(description));
+    QVERIFY(m->dropArea()->checkSanity());
+    QCOMPARE(dock1->window(), m.get());
+    QCOMPARE(dock2->window(), m.get());
+    QCOMPARE(dock3->frame(), dock2->frame());
+    QVERIFY(dock1->frame()->QWidget::y() > dock2->frame()->QWidget::y());
+
+    // startHidden also applies to the central frame, showing it later restores it there
+    auto dock6 = createDockWidget("dock6", new QPushButton("six"), {}, /*show=*/ false);
+    QVERIFY(m->addDockWidgets({ QVariantMap { { "name", "dock6" }, { "location", "center" }, { "startHidden", true } } }));
+    QVERIFY(!dock6->isVisible());
+    QVERIFY(m->dropArea()->checkSanity());
+    dock6->show();
+    QCOMPARE(dock6->window(), m.get());
+    QVERIFY(!dock6->isFloating());
+    QVERIFY(m->dropArea()->checkSanity());
+
+    // An invalid entry means nothing is docked
+    auto dock4 = createDockWidget("dock4", new QPushButton("four"));
+    SetExpectedWarning sew("Unknown dock widget");
+    QVERIFY(!m->addDockWidgets({ QVariantMap { { "name", "dock4" }, { "location", "left" } },
+                                 QVariantMap { { "name", "dock5" }, { "location", "left" } } }));
+    QVERIFY(dock4->isFloating());
+}
+
 void TestDocks::tst_addDockWidgetToContainingWindow()
 {
     EnsureTopLevelsDeleted e;
@@ -3796,6 +3913,305 @@ void TestDocks::tst_dragBySingleTab()
     Testing::waitForDeleted(frame1);
 }
 
+/// Returns the outline shown while dragging with Config::Flag_OutlineDragging, if any
+static QWidget *dragOutline()
+{
+    for (QWidget *w : qApp->topLevelWidgets()) {
+        if (w->objectName() == QLatin1String("_docks_DragOutline") && w->isVisible())
+            return w;
+    }
+
+    return nullptr;
+}
+
+void TestDocks::tst_outlineDragging()
+{
+    // Tests that with Flag_OutlineDragging only the outline follows the mouse, the window moves on release
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_OutlineDragging);
+
+    auto dock1 = createDockWidget("dock1", new MyWidget2(QSize(200, 200)));
+    auto fw = dock1->floatingWindow();
+    fw->move(100, 100);
+    const QPoint originalPos = fw->pos();
+    const QPoint dest = originalPos + QPoint(300, 300);
+
+    QWidget *draggable = draggableFor(fw);
+    drag(draggable, draggable->mapToGlobal(QPoint(10, 10)), dest, ButtonAction_Press);
+    QCOMPARE(fw->pos(), originalPos);
+    QWidget *outline = dragOutline();
+    QVERIFY(outline);
+    const QRect outlineGeometry = outline->geometry();
+    QVERIFY(outlineGeometry.topLeft() != originalPos);
+
+    drag(draggable, QPoint(), dest, ButtonAction_Release);
+    QCOMPARE(fw->geometry(), outlineGeometry);
+    QVERIFY(fw->isVisible());
+    QVERIFY(!dragOutline());
+
+    delete fw;
+}
+
+void TestDocks::tst_outlineDraggingDefersDetach()
+{
+    // Tests that with Flag_OutlineDragging, dragging a dock widget out of a main window only shows
+    // its new floating window once released
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_OutlineDragging);
+
+    auto m = createMainWindow(QSize(500, 500), MainWindowOption_None);
+    m->move(0, 0);
+    auto dock1 = createDockWidget("dock1", new QPushButton("1"));
+    auto dock2 = createDockWidget("dock2", new QPushButton("2"));
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+
+    QWidget *titleBar = dock2->frame()->titleBar();
+    const QPoint dest = m->geometry().topRight() + QPoint(200, 100);
+    drag(titleBar, titleBar->mapToGlobal(QPoint(10, 10)), dest, ButtonAction_Press);
+
+    // Detached, but the floating window stays hidden while only the outline follows the mouse
+    FloatingWindow *fw = dock2->floatingWindow();
+    QVERIFY(fw);
+    QVERIFY(!fw->isVisible());
+    QWidget *outline = dragOutline();
+    QVERIFY(outline);
+    const QRect outlineGeometry = outline->geometry();
+
+    releaseOn(dest, titleBar);
+    QVERIFY(fw->isVisible());
+    QCOMPARE(fw->geometry(), outlineGeometry);
+    QVERIFY(dock2->isFloating());
+    QVERIFY(!dragOutline());
+    QVERIFY(m->multiSplitter()->checkSanity());
+
+    delete fw;
+}
+
+void TestDocks::tst_lazyResizeFloatingWindow()
+{
+    // Tests that with Flag_LazyResize only the outline follows the mouse, the window is resized on release
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_LazyResize);
+
+    auto dock1 = createDockWidget("dock1", new MyWidget2(QSize(200, 200)));
+    auto fw = dock1->floatingWindow();
+    fw->move(100, 100);
+    const QRect originalGeometry = fw->geometry();
+
+    // Press on the bottom right corner and drag it away
+    const QPoint corner = fw->mapToGlobal(QPoint(fw->width() - 2, fw->height() - 2));
+    const QPoint dest = corner + QPoint(100, 50);
+    pressOn(corner, fw);
+    moveMouseTo(dest, fw);
+    QCOMPARE(fw->geometry(), originalGeometry);
+
+    releaseOn(dest, fw);
+    QCOMPARE(fw->geometry().topLeft(), originalGeometry.topLeft());
+    QCOMPARE(fw->geometry().bottomRight(), dest);
+    QVERIFY(fw->multiSplitter()->checkSanity());
+
+    delete fw;
+}
+
+// Counts the repaints and geometry changes of a widget
+class RepaintCounter : public QObject
+{
+public:
+    explicit RepaintCounter(QWidget *w)
+    {
+        w->installEventFilter(this);
+    }
+
+    bool eventFilter(QObject *, QEvent *ev) override
+    {
+        switch (ev->type()) {
+        case QEvent::Paint:
+            ++numPaints;
+            paintedRegion += static_cast<QPaintEvent *>(ev)->region();
+            break;
+        case QEvent::Move:
+        case QEvent::Resize:
+            ++numGeometryChanges;
+            break;
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+    void reset()
+    {
+        numPaints = 0;
+        numGeometryChanges = 0;
+        paintedRegion = {};
+    }
+
+    int numPaints = 0;
+    int numGeometryChanges = 0;
+    QRegion paintedRegion;
+};
+
+// Sends a single mouse move to the widget being dragged, unlike moveMouseTo() which walks pixel by pixel
+static void hoverDuringDrag(QWidget *draggable, QPoint globalPos)
+{
+    QCursor::setPos(globalPos);
+    QMouseEvent ev(QEvent::MouseMove, draggable->mapFromGlobal(globalPos), draggable->window()->mapFromGlobal(globalPos),
+                   globalPos, Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+    qApp->sendEvent(draggable, &ev);
+    QCoreApplication::processEvents(); // Flushes the repaints
+}
+
+void TestDocks::tst_segmentedIndicatorsPartialRepaint()
+{
+    // Tests that SegmentedIndicators only repaints the segments whose highlight changed
+    EnsureTopLevelsDeleted e; // Also restores the indicator type
+    DefaultWidgetFactory::s_dropIndicatorType = DropIndicatorType::Segmented;
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    m->move(0, 0);
+    auto dock1 = createDockWidget("dock1", new QPushButton("1"));
+    auto dock2 = createDockWidget("dock2", new QPushButton("2"));
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+
+    auto dock3 = createDockWidget("dock3", new QPushButton("3"));
+    auto fw = dock3->floatingWindow();
+    fw->move(m->geometry().topRight() + QPoint(100, 0));
+
+    auto overlay = qobject_cast<SegmentedIndicators *>(m->dropArea()->dropIndicatorOverlay());
+    QVERIFY(overlay);
+
+    Frame *frame1 = dock1->frame();
+    const QPoint frameCenter = frame1->mapToGlobal(frame1->rect().center());
+    QWidget *draggable = draggableFor(fw);
+    drag(draggable, draggable->mapToGlobal(QPoint(10, 10)), frameCenter, ButtonAction_Press);
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Center);
+
+    RepaintCounter counter(overlay);
+    QCoreApplication::processEvents();
+    counter.reset();
+
+    // Moving within the same segment doesn't repaint anything
+    hoverDuringDrag(draggable, frameCenter + QPoint(2, 2));
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Center);
+    QCOMPARE(counter.numPaints, 0);
+
+    // Find a point of the frame's left segment, along the horizontal line through its center
+    const QPoint localCenter = overlay->mapFromGlobal(frameCenter);
+    QPoint leftPos;
+    for (int x = localCenter.x(); x >= 0; --x) {
+        if (overlay->dropLocationForPos({ x, localCenter.y() }) == DropIndicatorOverlayInterface::DropLocation_Left) {
+            leftPos = { x, localCenter.y() };
+            break;
+        }
+    }
+    QVERIFY(!leftPos.isNull());
+
+    // Moving to another segment highlights it, repainting only the old and new segments
+    hoverDuringDrag(draggable, overlay->mapToGlobal(leftPos));
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Left);
+    QVERIFY(counter.numPaints > 0);
+    QVERIFY(counter.paintedRegion.contains(leftPos));
+    QVERIFY(!(QRegion(overlay->rect()) - counter.paintedRegion).isEmpty());
+
+    // Hovering the same segment again doesn't repaint either
+    counter.reset();
+    hoverDuringDrag(draggable, overlay->mapToGlobal(leftPos) + QPoint(0, 1));
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Left);
+    QCOMPARE(counter.numPaints, 0);
+
+    releaseOn(frameCenter, draggable);
+    QVERIFY(m->multiSplitter()->checkSanity());
+}
+
+void TestDocks::tst_classicIndicatorsSkipRepaint()
+{
+    // Tests that ClassicIndicators doesn't move nor repaint the rubber band while the drop location stays the same
+    EnsureTopLevelsDeleted e; // Also restores the indicator type
+    DefaultWidgetFactory::s_dropIndicatorType = DropIndicatorType::Classic;
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    m->move(0, 0);
+    auto dock1 = createDockWidget("dock1", new QPushButton("1"));
+    auto dock2 = createDockWidget("dock2", new QPushButton("2"));
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+
+    auto dock3 = createDockWidget("dock3", new QPushButton("3"));
+    auto fw = dock3->floatingWindow();
+    fw->move(m->geometry().topRight() + QPoint(100, 0));
+
+    DropIndicatorOverlayInterface *overlay = m->dropArea()->dropIndicatorOverlay();
+    QVERIFY(qobject_cast<ClassicIndicators *>(overlay));
+    auto rubberBand = m->dropArea()->findChild<QRubberBand *>();
+    QVERIFY(rubberBand);
+
+    Frame *frame1 = dock1->frame();
+    QWidget *draggable = draggableFor(fw);
+    drag(draggable, draggable->mapToGlobal(QPoint(10, 10)), frame1->mapToGlobal(frame1->rect().center()), ButtonAction_Press);
+
+    const QPoint centerPos = overlay->posForIndicator(DropIndicatorOverlayInterface::DropLocation_Center);
+    hoverDuringDrag(draggable, centerPos);
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Center);
+    QVERIFY(rubberBand->isVisible());
+
+    RepaintCounter counter(rubberBand);
+    QCoreApplication::processEvents();
+    counter.reset();
+
+    // Moving over the same indicator leaves the rubber band alone
+    hoverDuringDrag(draggable, centerPos + QPoint(1, 1));
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Center);
+    QCOMPARE(counter.numGeometryChanges, 0);
+    QCOMPARE(counter.numPaints, 0);
+
+    // Moving to another indicator moves the rubber band
+    const QRect centerRubberBandGeometry = rubberBand->geometry();
+    hoverDuringDrag(draggable, overlay->posForIndicator(DropIndicatorOverlayInterface::DropLocation_Left));
+    QCOMPARE(overlay->currentDropLocation(), DropIndicatorOverlayInterface::DropLocation_Left);
+    QVERIFY(counter.numGeometryChanges > 0);
+    QVERIFY(rubberBand->geometry() != centerRubberBandGeometry);
+    QVERIFY(rubberBand->isVisible());
+
+    releaseOn(frame1->mapToGlobal(frame1->rect().center()), draggable);
+    QVERIFY(m->multiSplitter()->checkSanity());
+}
+
+void TestDocks::tst_lazyWindowResize()
+{
+    // Tests that with Flag_LazyWindowResize the layout only follows the window size after an interval
+    EnsureTopLevelsDeleted e;
+    Config::self().setFlags(Config::self().flags() | Config::Flag_LazyWindowResize);
+    const int originalInterval = Config::self().lazyWindowResizeInterval();
+    Config::self().setLazyWindowResizeInterval(500);
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("1", new QPushButton("1"));
+    m->addDockWidget(dock1, Location_OnLeft);
+    MultiSplitter *layout = m->multiSplitter();
+    QTRY_VERIFY(!layout->hasPendingResize());
+
+    m->resize(m->size() + QSize(100, 50));
+    QTRY_VERIFY(layout->hasPendingResize());
+    QVERIFY(layout->size() != layout->QWidgetAdapter::size()); // Not relayouted yet
+    QTRY_VERIFY(!layout->hasPendingResize());
+    QCOMPARE(layout->size(), layout->QWidgetAdapter::size());
+    QVERIFY(layout->checkSanity());
+
+    // Changing the layout applies the pending resize first
+    m->resize(m->size() + QSize(100, 50));
+    QTRY_VERIFY(layout->hasPendingResize());
+    auto dock2 = createDockWidget("2", new QPushButton("2"));
+    m->addDockWidget(dock2, Location_OnRight);
+    QVERIFY(!layout->hasPendingResize());
+    QCOMPARE(layout->size(), layout->QWidgetAdapter::size());
+    QVERIFY(layout->checkSanity());
+
+    Config::self().setLazyWindowResizeInterval(originalInterval);
+}
+
 void TestDocks::tst_addToHiddenMainWindow()
 {
     EnsureTopLevelsDeleted e;
@@ -3866,6 +4282,33 @@ void TestDocks::tst_minSizeChanges()
     delete m;
 }
 
+void TestDocks::tst_sizeConstraintsCache()
+{
+    // Tests that the frame's min/max sizes are cached until its layout is invalidated
+    EnsureTopLevelsDeleted e;
+    auto m = createMainWindow(QSize(1000, 1000), MainWindowOption_None);
+    auto w1 = new MyWidget2(QSize(200, 200));
+    auto d1 = new DockWidget("1");
+    d1->setWidget(w1);
+    m->addDockWidget(d1, Location_OnTop);
+    Frame *frame = d1->frame();
+
+    const QSize minSize = frame->minSize();
+    const QSize maxSize = frame->maxSizeHint();
+    const qint64 count = Layouting::Widget::sizeConstraintsComputationCount();
+    for (int i = 0; i < 10; ++i) {
+        QCOMPARE(frame->minSize(), minSize);
+        QCOMPARE(frame->maxSizeHint(), maxSize);
+    }
+    QCOMPARE(Layouting::Widget::sizeConstraintsComputationCount(), count);
+
+    // Changing the guest's min size invalidates it
+    w1->setMinSize(QSize(500, 500));
+    QTRY_VERIFY(frame->minSize().width() >= 500);
+    QVERIFY(Layouting::Widget::sizeConstraintsComputationCount() > count);
+    QCOMPARE(m->multiSplitter()->itemForFrame(frame)->minSize(), frame->minSize());
+}
+
 void TestDocks::tst_complex()
 {
     // Tests some anchors out of bounds I got
@@ -4090,6 +4533,51 @@ void TestDocks::tst_rectForDropCrash()
     delete m->window();
 }
 
+void TestDocks::tst_rectForDropCache()
+{
+    // Tests that MultiSplitter::rectForDrop() caches its results until the layout changes
+    EnsureTopLevelsDeleted e;
+
+    auto m = new MainWindow("m1", MainWindowOption_HasCentralFrame);
+    m->resize(QSize(500, 500));
+    m->show();
+
+    auto layout = m->multiSplitter();
+    auto d1 = createDockWidget("1", new MyWidget2(QSize(400, 400)));
+    auto d2 = createDockWidget("2", new MyWidget2(QSize(400, 400)));
+    auto d3 = createDockWidget("3", new MyWidget2(QSize(400, 400)));
+    m->addDockWidget(d1, Location_OnTop);
+
+    Item *centralItem = m->dropArea()->centralFrame();
+    const QRect rect1 = layout->rectForDrop(d2->floatingWindow(), Location_OnTop, centralItem);
+    QCOMPARE(layout->dropRectCacheMisses(), 1);
+    QCOMPARE(layout->dropRectCacheHits(), 0);
+
+    // Same query, served from the cache
+    QCOMPARE(layout->rectForDrop(d2->floatingWindow(), Location_OnTop, centralItem), rect1);
+    QCOMPARE(layout->dropRectCacheMisses(), 1);
+    QCOMPARE(layout->dropRectCacheHits(), 1);
+
+    // Different location is a miss
+    layout->rectForDrop(d2->floatingWindow(), Location_OnLeft, centralItem);
+    QCOMPARE(layout->dropRectCacheMisses(), 2);
+
+    // Changing the layout invalidates the cache
+    m->addDockWidget(d3, Location_OnBottom);
+    layout->rectForDrop(d2->floatingWindow(), Location_OnTop, centralItem);
+    QCOMPARE(layout->dropRectCacheMisses(), 3);
+
+    // So does ending the hover
+    m->dropArea()->removeHover();
+    layout->rectForDrop(d2->floatingWindow(), Location_OnTop, centralItem);
+    QCOMPARE(layout->dropRectCacheMisses(), 4);
+    QCOMPARE(layout->dropRectCacheHits(), 1);
+
+    layout->checkSanity();
+    delete d2->window();
+    delete m->window();
+}
+
 void TestDocks::tst_availableSizeWithPlaceholders()
 {
     // Tests MultiSplitterLayout::available() with and without placeholders. The result should be the same.
@@ -4469,6 +4957,86 @@ void TestDocks::tst_invalidJSON()
     QCOMPARE(restorer.restoreFromFile(absoluteLayoutFileName), expectedResult);
 }
 
+// Returns @p saved with the first item of the first main window's splitter tree changed by @p change
+static QByteArray tamperFirstItem(const QByteArray &saved, const std::function<void(QVariantMap &)> &change)
+{
+    QVariantMap layout = QJsonDocument::fromJson(saved).toVariant().toMap();
+    QVariantList mainWindows = layout.value(QStringLiteral("mainWindows")).toList();
+    QVariantMap mainWindow = mainWindows.at(0).toMap();
+    QVariantMap multiSplitter = mainWindow.value(QStringLiteral("multiSplitterLayout")).toMap();
+    QVariantMap root = multiSplitter.value(QStringLiteral("layout")).toMap();
+    QVariantList children = root.value(QStringLiteral("children")).toList();
+    QVariantMap item = children.at(0).toMap();
+
+    change(item);
+
+    children[0] = item;
+    root.insert(QStringLiteral("children"), children);
+    multiSplitter.insert(QStringLiteral("layout"), root);
+    mainWindow.insert(QStringLiteral("multiSplitterLayout"), multiSplitter);
+    mainWindows[0] = mainWindow;
+    layout.insert(QStringLiteral("mainWindows"), mainWindows);
+
+    return QJsonDocument::fromVariant(layout).toJson();
+}
+
+void TestDocks::tst_validateLayout()
+{
+    EnsureTopLevelsDeleted e;
+    auto m1 = createMainWindow(QSize(800, 500), MainWindowOption_None, "MyMainWindow1");
+    auto dock1 = createDockWidget("1", new QPushButton("one"));
+    auto dock2 = createDockWidget("2", new QPushButton("two"));
+    auto dock3 = createDockWidget("3", new QPushButton("three"));
+    m1->addDockWidget(dock1, Location_OnLeft);
+    m1->addDockWidget(dock2, Location_OnRight);
+    m1->addDockWidget(dock3, Location_OnBottom, dock2);
+
+    LayoutSaver saver;
+    const QByteArray saved = saver.serializeLayout();
+    QVERIFY(LayoutSaver::validateLayout(saved));
+
+    // Validating doesn't create or touch any widget
+    QCOMPARE(DockRegistry::self()->frames().size(), 3);
+    QCOMPARE(DockRegistry::self()->nestedwindows().size(), 0);
+
+    {
+        SetExpectedWarning sew("Failed to parse json data");
+        QVERIFY(!LayoutSaver::validateLayout("{ not json"));
+    }
+
+    {
+        // The replayed tree doesn't fill its container anymore
+        const QByteArray tampered = tamperFirstItem(saved, [] (QVariantMap &item) {
+            QVariantMap sizingInfo = item.value(QStringLiteral("sizingInfo")).toMap();
+            QRect geometry = mapToRect(sizingInfo.value(QStringLiteral("geometry")).toMap());
+            geometry.setWidth(geometry.width() - 100);
+            sizingInfo.insert(QStringLiteral("geometry"), rectToMap(geometry));
+            item.insert(QStringLiteral("sizingInfo"), sizingInfo);
+        });
+
+        SetExpectedWarning sew("checkChildGeometries");
+        QVERIFY(!LayoutSaver::validateLayout(tampered));
+    }
+
+    {
+        const QByteArray tampered = tamperFirstItem(saved, [] (QVariantMap &item) {
+            item.insert(QStringLiteral("guestId"), QStringLiteral("unknown-frame"));
+        });
+
+        SetExpectedWarning sew("Item refers to unknown frame");
+        QVERIFY(!LayoutSaver::validateLayout(tampered));
+    }
+
+    // Still nothing was touched, and the untampered layout is still valid
+    QCOMPARE(DockRegistry::self()->frames().size(), 3);
+    QVERIFY(LayoutSaver::validateLayout(saved));
+
+    QFile f(QStringLiteral(":/layouts/unsupported-serialization-version.json"));
+    QVERIFY(f.open(QIODevice::ReadOnly));
+    SetExpectedWarning sew("Serialization format is too old");
+    QVERIFY(!LayoutSaver::validateLayout(f.readAll()));
+}
+
 void TestDocks::tst_stealFrame()
 {
     // Tests using addWidget() with dock widgets which are already in a layout
@@ -4839,6 +5407,241 @@ void TestDocks::tst_clear()
     QVERIFY(Testing::waitForDeleted(dock3));
 }
 
+void TestDocks::tst_framePool()
+{
+    // Tests that with Config::setFramePoolSize() empty frames are reused instead of deleted
+    EnsureTopLevelsDeleted e;
+    Config::self().setFramePoolSize(1);
+
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("1", new QPushButton("1"));
+    auto dock2 = createDockWidget("2", new QPushButton("2"));
+    auto dock3 = createDockWidget("3", new QPushButton("3"), {}, /*show=*/false);
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+    QTest::qWait(100); // frames are released from the event loop
+    QCOMPARE(Frame::dbg_numFrames(), 2);
+
+    // The floating frames dock1 and dock2 had are the first to be recycled, clear them
+    Config::self().setFramePoolSize(0);
+    Config::self().setFramePoolSize(1);
+    QCOMPARE(FramePool::self()->count(), 0);
+
+    QPointer<Frame> frame2 = dock2->frame();
+    dock2->close();
+    QTest::qWait(100);
+
+    QVERIFY(frame2); // Wasn't deleted, went into the pool
+    QCOMPARE(FramePool::self()->count(), 1);
+    QCOMPARE(Frame::dbg_numFrames(), 1);
+    QCOMPARE(m->multiSplitter()->visibleCount(), 1);
+
+    // Adding a new dock widget reuses it
+    m->addDockWidget(dock3, Location_OnBottom);
+    QCOMPARE(dock3->frame(), frame2.data());
+    QCOMPARE(FramePool::self()->count(), 0);
+    QCOMPARE(Frame::dbg_numFrames(), 2);
+    QVERIFY(frame2->isVisible());
+    m->multiSplitter()->checkSanity();
+
+    // Disabling the pool deletes what's pooled
+    dock3->close();
+    QTest::qWait(100);
+    QCOMPARE(FramePool::self()->count(), 1);
+    Config::self().setFramePoolSize(0);
+    QCOMPARE(FramePool::self()->count(), 0);
+    QVERIFY(!frame2);
+
+    delete dock2;
+    delete dock3;
+}
+
+void TestDocks::tst_floatingWindowPool()
+{
+    // Tests that with Config::setFloatingWindowPoolSize() empty floating windows are reused
+    EnsureTopLevelsDeleted e;
+    Config::self().setFloatingWindowPoolSize(1);
+
+    auto dock1 = createDockWidget("1", new QPushButton("1"));
+    QPointer<FloatingWindow> fw1 = dock1->floatingWindow();
+    QVERIFY(fw1);
+
+    dock1->close();
+    QTest::qWait(100); // windows are recycled from the event loop
+    QVERIFY(fw1); // Wasn't deleted, went into the pool
+    QVERIFY(!fw1->isVisible());
+    QCOMPARE(FloatingWindowPool::self()->count(), 1);
+    QVERIFY(!DockRegistry::self()->nestedwindows().contains(fw1));
+
+    // Showing it again reuses the same window
+    dock1->show();
+    QCOMPARE(dock1->floatingWindow(), fw1.data());
+    QVERIFY(fw1->isVisible());
+    QCOMPARE(FloatingWindowPool::self()->count(), 0);
+    QVERIFY(DockRegistry::self()->nestedwindows().contains(fw1));
+    QVERIFY(fw1->dropArea()->checkSanity());
+
+    // Disabling the pool deletes what's pooled
+    dock1->close();
+    QTest::qWait(100);
+    QCOMPARE(FloatingWindowPool::self()->count(), 1);
+    Config::self().setFloatingWindowPoolSize(0);
+    QCOMPARE(FloatingWindowPool::self()->count(), 0);
+    QVERIFY(!fw1);
+
+    delete dock1;
+}
+
+void TestDocks::tst_lazyWidgetFactory()
+{
+    // Tests that DockWidgetBase::setWidgetFactory() only creates the guest when the tab is current
+    EnsureTopLevelsDeleted e;
+    auto m = createMainWindow();
+    m->hide();
+
+    auto factory = [] (DockWidgetBase *dw) -> QWidgetOrQuick * {
+        return new QPushButton(dw->uniqueName());
+    };
+
+    auto dock1 = createDockWidget("1", new QPushButton("1"), {}, /*show=*/ false);
+    auto dock2 = new DockWidget("2");
+    dock2->setWidgetFactory(factory);
+    QVERIFY(dock2->hasPendingWidget());
+    QVERIFY(!dock2->widget());
+
+    m->addDockWidget(dock1, Location_OnLeft);
+    dock1->addDockWidgetAsTab(dock2);
+    dock1->setAsCurrentTab();
+    m->show();
+    QVERIFY(dock1->isVisible());
+    QVERIFY(!dock2->isVisible());
+    QVERIFY(dock2->hasPendingWidget());
+    QVERIFY(!dock2->widget());
+
+    // Becoming current creates it
+    dock2->setAsCurrentTab();
+    QVERIFY(dock2->isVisible());
+    QVERIFY(!dock2->hasPendingWidget());
+    QVERIFY(qobject_cast<QPushButton*>(dock2->widget()));
+    QVERIFY(dock2->widget()->isVisible());
+
+    // ensureWidget() creates it explicitly, setWidget() discards the factory
+    auto dock3 = new DockWidget("3");
+    dock3->setWidgetFactory(factory);
+    dock3->ensureWidget();
+    QVERIFY(!dock3->hasPendingWidget());
+    QVERIFY(dock3->widget());
+
+    auto dock4 = new DockWidget("4");
+    dock4->setWidgetFactory(factory);
+    auto button4 = new QPushButton("4");
+    dock4->setWidget(button4);
+    QVERIFY(!dock4->hasPendingWidget());
+    QCOMPARE(dock4->widget(), button4);
+
+    delete dock3;
+    delete dock4;
+}
+
+void TestDocks::tst_hibernation()
+{
+    // Tests that closed dock widgets release their guest after Config::dockWidgetHibernationTimeout()
+    EnsureTopLevelsDeleted e;
+    Config::self().setDockWidgetHibernationTimeout(100);
+
+    static int s_numReleased = 0;
+    auto factory = [] (DockWidgetBase *dw) -> QWidgetOrQuick * {
+        auto guest = new QWidget();
+        auto lay = new QVBoxLayout(guest);
+        lay->addWidget(new QPushButton(dw->uniqueName()));
+        lay->addWidget(new QLineEdit());
+        return guest;
+    };
+    auto release = [] (DockWidgetBase *, QWidgetOrQuick *) {
+        s_numReleased++;
+    };
+
+    auto dock1 = new DockWidget("1");
+    dock1->setWidgetFactory(factory, release);
+    dock1->show();
+    QPointer<QWidget> guest1 = dock1->widget();
+    QVERIFY(guest1);
+    QVERIFY(!dock1->hibernate()); // Still open
+
+    // A dock widget without factory can't recreate its guest, so doesn't hibernate
+    auto dock2 = createDockWidget("2", new QPushButton("2"));
+    dock2->close();
+
+    QSignalSpy widgetChangedSpy(dock1, &DockWidgetBase::widgetChanged);
+    dock1->close();
+    QTRY_VERIFY(dock1->isHibernated());
+    QVERIFY(!guest1);
+    QCOMPARE(widgetChangedSpy.count(), 1);
+    QVERIFY(!widgetChangedSpy.at(0).at(0).value<QWidgetOrQuick*>());
+    QVERIFY(!dock1->widget());
+    QVERIFY(dock1->hasPendingWidget());
+    QCOMPARE(s_numReleased, 1);
+    QVERIFY(!dock2->isHibernated());
+    QVERIFY(!dock2->hibernate());
+    QVERIFY(dock2->widget());
+
+    QCOMPARE(DockRegistry::self()->hibernatedDockwidgets(), DockWidgetBase::List({dock1}));
+    QVERIFY(DockRegistry::self()->hibernatedQObjectCount() >= 4);
+
+    // Showing it again recreates the guest
+    dock1->show();
+    QVERIFY(dock1->widget());
+    QVERIFY(dock1->widget()->isVisible());
+    QVERIFY(!dock1->isHibernated());
+    QVERIFY(DockRegistry::self()->hibernatedDockwidgets().isEmpty());
+    QCOMPARE(DockRegistry::self()->hibernatedQObjectCount(), 0);
+
+    Config::self().setDockWidgetHibernationTimeout(0);
+    delete dock1->window();
+    delete dock2;
+}
+
+void TestDocks::tst_statistics()
+{
+    EnsureTopLevelsDeleted e;
+    auto m = createMainWindow(QSize(800, 500), MainWindowOption_None, "tst_statistics");
+    auto dock1 = createDockWidget("dock1", new QPushButton("one"), {}, /*show=*/false);
+    auto dock2 = createDockWidget("dock2", new QPushButton("two"), {}, /*show=*/false);
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+
+    Statistics stats = Statistics::snapshot();
+    QCOMPARE(stats.numMainWindows, 1);
+    QCOMPARE(stats.numDockWidgets, 2);
+    QCOMPARE(stats.numFloatingWindows, 0);
+    QVERIFY(stats.numFrames >= 2);
+    QVERIFY(stats.numNativeWindows >= 1);
+    QCOMPARE(stats.layouts.size(), 1);
+    QCOMPARE(stats.layouts.at(0).name, QStringLiteral("tst_statistics"));
+    QCOMPARE(stats.layouts.at(0).numItems, 2);
+    QCOMPARE(stats.layouts.at(0).numPlaceholders, 0);
+    QCOMPARE(stats.layouts.at(0).numContainers, 0);
+    QCOMPARE(stats.layouts.at(0).numSeparators, 1);
+
+    dock2->close();
+    stats = Statistics::snapshot();
+    QCOMPARE(stats.layouts.at(0).numItems, 2);
+    QCOMPARE(stats.layouts.at(0).numPlaceholders, 1);
+
+    // Activity counters only grow
+    const qint64 numRelayouts = stats.numRelayouts;
+    const qint64 numGuestGeometryChanges = stats.numGuestGeometryChanges;
+    m->resize(m->size() + QSize(100, 100));
+    QTRY_VERIFY(Statistics::snapshot().numRelayouts > numRelayouts);
+    QVERIFY(Statistics::snapshot().numGuestGeometryChanges > numGuestGeometryChanges);
+
+    const QVariantMap map = stats.toVariantMap();
+    QCOMPARE(map.value(QStringLiteral("numDockWidgets")).toInt(), 2);
+    QCOMPARE(map.value(QStringLiteral("layouts")).toList().size(), 1);
+
+    delete dock2;
+}
+
 void TestDocks::tst_restoreEmbeddedMainWindow()
 {
     EnsureTopLevelsDeleted e;
@@ -198,16 +198,20 @@ void KDDockWidgets::Tests::moveMouseTo(QPoint globalDest, QWidget *receiver)
             globalSrc.setY(globalSrc.y() - 1);
         }
 
-        QCursor::setPos(globalSrc); // Since some code uses QCursor::pos()
-        QMouseEvent ev(QEvent::MouseMove, receiver->mapFromGlobal(globalSrc), receiver->window()->mapFromGlobal(globalSrc), globalSrc,
-                       Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
-
         if (!receiverP) {
             qWarning() << "Receiver was deleted";
             return;
         }
 
-        qApp->sendEvent(receiver, &ev);
+        moveMouseOnce(globalSrc, receiver);
         QTest::qWait(2);
     }
 }
+
+void KDDockWidgets::Tests::moveMouseOnce(QPoint globalPos, QWidget *receiver)
+{
+    QCursor::setPos(globalPos); // Since some code uses QCursor::pos()
+    QMouseEvent ev(QEvent::MouseMove, receiver->mapFromGlobal(globalPos), receiver->window()->mapFromGlobal(globalPos), globalPos,
+                   Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+    qApp->sendEvent(receiver, &ev);
+}
@@ -16,6 +16,7 @@
 #include "DropIndicatorOverlayInterface_p.h"
 #include "DockWidgetBase.h"
 #include "Config.h"
+#include "FrameworkWidgetFactory.h"
 
 #ifdef KDDOCKWIDGETS_QTWIDGETS
 # include <QWidget>
@@ -54,6 +55,8 @@ struct EnsureTopLevelsDeleted
     EnsureTopLevelsDeleted()
         : m_originalFlags(Config::self().flags())
         , m_originalSeparatorThickness(Config::self().separatorThickness())
+        , m_originalDraggedWindowOpacity(Config::self().draggedWindowOpacity())
+        , m_originalDropIndicatorType(DefaultWidgetFactory::s_dropIndicatorType)
     {
     }
 
@@ -67,6 +70,8 @@ struct EnsureTopLevelsDeleted
         Config::self().setDockWidgetFactoryFunc(nullptr);
         Config::self().setFlags(m_originalFlags);
         Config::self().setSeparatorThickness(m_originalSeparatorThickness);
+        Config::self().setDraggedWindowOpacity(m_originalDraggedWindowOpacity);
+        DefaultWidgetFactory::s_dropIndicatorType = m_originalDropIndicatorType;
     }
 
     QWidgetList topLevels() const
@@ -83,6 +88,8 @@ struct EnsureTopLevelsDeleted
 
     const Config::Flags m_originalFlags;
     const int m_originalSeparatorThickness;
+    const qreal m_originalDraggedWindowOpacity;
+    const DropIndicatorType m_originalDropIndicatorType;
 };
 
 bool shouldBlacklistWarning(const QString &msg, const QString &category = {});
@@ -137,6 +144,9 @@ void pressOn(QPoint globalPos, QWidget *receiver);
 void releaseOn(QPoint globalPos, QWidget *receiver);
 void moveMouseTo(QPoint globalDest, QWidget *receiver);
 
+///@brief Sends a single mouse move to @p globalPos, without waiting. For when each move is measured.
+void moveMouseOnce(QPoint globalPos, QWidget *receiver);
+
 }
 
 inline bool qpaPassedAsArgument(int argc, char *argv[])